@@ -314,6 +314,39 @@ export interface IIPC {
     connect(uri: string): void;
     host(uri: string): void;
     disconnect(): void;
+    getStartupTiming(): IIPCStartupTiming;
+    callBatch(calls: IIPCBatchCall[]): any[][];
+    setDeferredErrorCallback(callback: ((collection: string, func: string, code: number, message: string) => void) | null): void;
+    getCallStats(): IIPCCallStats[];
+    startTrace(path: string): void;
+    stopTrace(): void;
+}
+export declare type EIPCValueType = 'null' | 'float' | 'double' | 'int32' | 'int64' | 'uint32' | 'uint64' | 'string' | 'binary';
+export interface IIPCValue {
+    type: EIPCValueType;
+    value: number | string | ArrayBufferView;
+}
+export interface IIPCBatchCall {
+    collection: string;
+    func: string;
+    args?: IIPCValue[];
+}
+export interface IIPCStartupTiming {
+    spawnMs: number;
+    readyMs: number;
+    connectMs: number;
+    firstCallMs: number;
+}
+export interface IIPCCallStats {
+    name: string;
+    count: number;
+    totalMs: number;
+    p50Ms: number;
+    p90Ms: number;
+    p99Ms: number;
+    maxMs: number;
+    requestBytes: number;
+    responseBytes: number;
 }
 export interface IGlobal {
     startup(locale: string, path?: string): void;
@@ -338,6 +371,11 @@ export interface IFontProperty extends IProperty {
 }
 export interface IListProperty extends IProperty {
     readonly details: IListDetails;
+    getItems(offset: number, count: number): {
+        name: string;
+        value: string | number;
+        enabled: boolean;
+    }[];
 }
 export interface IListDetails {
     readonly format: EListFormat;
@@ -345,6 +383,7 @@ export interface IListDetails {
         name: string;
         value: string | number;
     }[];
+    readonly itemCount: number;
 }
 export interface IEditableListProperty extends IProperty {
     readonly details: IEditableListDetails;
@@ -397,6 +436,11 @@ export interface IProperties {
 export interface IFactoryTypes {
     types(): string[];
 }
+export interface ISourceFactoryTypes extends IFactoryTypes {
+    getTypeProperties(id: string): IProperties;
+    getTypeDefaults(id: string): ISettings;
+    getTypeOutputFlags(id: string): ESourceOutputFlags;
+}
 export interface IReleasable {
     release(): void;
 }
@@ -477,16 +521,35 @@ export interface IService extends IConfigurable, IReleasable {
     readonly name: string;
     readonly id: string;
 }
-export interface IFilterFactory extends IFactoryTypes {
+export interface IFilterFactory extends ISourceFactoryTypes {
     create(id: string, name: string, settings?: ISettings): IFilter;
 }
 export interface IFilter extends ISource {
 }
-export interface IInputFactory extends IFactoryTypes {
+export interface IInputFactory extends ISourceFactoryTypes {
     create(id: string, name: string, settings?: ISettings, hotkeys?: ISettings): IInput;
     createPrivate(id: string, name: string, settings?: ISettings): IInput;
     fromName(name: string): IInput;
+    typesAsync(): Promise<string[]>;
     getPublicSources(): IInput[];
+    getSnapshot(sources?: ISource[]): ISourceSnapshot;
+}
+export interface ISourceSnapshot {
+    readonly count: number;
+    readonly strings: string[];
+    readonly name: Uint32Array;
+    readonly id: Uint32Array;
+    readonly flags: Uint32Array;
+    readonly outputFlags: Uint32Array;
+    readonly muted: Uint8Array;
+    readonly enabled: Uint8Array;
+    readonly active: Uint8Array;
+    readonly showing: Uint8Array;
+    readonly volume: Float32Array;
+    readonly monitoringType: Int32Array;
+    readonly width: Uint32Array;
+    readonly height: Uint32Array;
+    readonly sourceId: Float64Array;
 }
 export declare const enum EInteractionFlags {
     None = 0,
@@ -556,9 +619,31 @@ export interface IScene extends ISource {
     findItem(id: string | number): ISceneItem;
     getItemAtIdx(idx: number): ISceneItem;
     getItems(): ISceneItem[];
+    getSnapshot(sinceVersion?: number): ISceneSnapshot;
     connect(sigType: ESceneSignalType, cb: (info: ISettings) => void): ICallbackData;
     disconnect(data: ICallbackData): void;
 }
+export interface ISceneItemState {
+    readonly item: ISceneItem;
+    readonly source: IInput;
+    readonly id: number;
+    readonly position: IVec2;
+    readonly rotation: number;
+    readonly scale: IVec2;
+    readonly alignment: EAlignment;
+    readonly bounds: IVec2;
+    readonly boundsType: EBoundsType;
+    readonly boundsAlignment: number;
+    readonly crop: ICropInfo;
+    readonly scaleFilter: EScaleType;
+    readonly visible: boolean;
+    readonly selected: boolean;
+}
+export interface ISceneSnapshot {
+    readonly version: number;
+    readonly changed: boolean;
+    readonly items?: ISceneItemState[];
+}
 export interface ISceneItem {
     readonly source: IInput;
     readonly scene: IScene;
@@ -584,7 +669,7 @@ export interface ISceneItem {
     deferUpdateBegin(): void;
     deferUpdateEnd(): void;
 }
-export interface ITransitionFactory extends IFactoryTypes {
+export interface ITransitionFactory extends ISourceFactoryTypes {
     create(id: string, name: string, settings?: ISettings, hotkeys?: ISettings): ITransition;
     createPrivate(id: string, name: string, settings?: ISettings): ITransition;
     fromName(name: string): ITransition;
@@ -601,9 +686,16 @@ export interface IConfigurable {
     readonly properties: IProperties;
     readonly settings: ISettings;
 }
+export interface ISettingsDelta {
+    settings: ISettings;
+    version: number;
+    full: boolean;
+}
 export interface ISource extends IConfigurable, IReleasable {
     remove(): void;
     save(): void;
+    getPropertiesAsync(listPageSize?: number): Promise<IProperties>;
+    getSettingsSince(version: number): ISettingsDelta;
     readonly status: number;
     readonly type: ESourceType;
     readonly id: string;
@@ -632,7 +724,7 @@ export interface IVolmeter {
     updateInterval: number;
     attach(source: IInput): void;
     detach(): void;
-    addCallback(cb: (magnitude: number[], peak: number[], inputPeak: number[]) => void): ICallbackData;
+    addCallback(cb: (magnitude: Float32Array, peak: Float32Array, inputPeak: Float32Array) => void): ICallbackData;
     removeCallback(cbData: ICallbackData): void;
 }
 export interface ICallbackData {
@@ -454,6 +454,85 @@ export interface IIPC {
      * Disconnect from a server.
      */
 	disconnect(): void;
+
+    /**
+     * Returns how long each step of the last host() call took.
+     * All values are milliseconds since host() was called.
+     */
+	getStartupTiming(): IIPCStartupTiming;
+
+    /**
+     * Runs several server calls in order in a single round trip.
+     * @param calls - Calls to run, each with its collection, function and typed arguments.
+     * @returns One result array per call, the first element being the error code.
+	 * @throws SyntaxError if an invalid number of parameters is given.
+	 * @throws TypeError if a call or argument is malformed.
+	 * @throws Error if the batch could not be sent.
+     */
+	callBatch(calls: IIPCBatchCall[]): any[][];
+
+    /**
+     * Sets the function that receives errors from fire-and-forget setters.
+     * Setters such as volume, muted and position return before the server
+     * applied them, so failures are reported here later instead of thrown.
+     * @param callback - Called with the collection, function, error code and message, or null to stop reporting.
+	 * @throws TypeError if callback is neither a function nor null.
+     */
+	setDeferredErrorCallback(callback: ((collection: string, func: string, code: number, message: string) => void) | null): void;
+
+    /**
+     * Returns timing and size statistics for every server function called so far.
+     * @returns One entry per called function, named as 'Collection.Function'.
+	 * @throws Error if the statistics could not be retrieved.
+     */
+	getCallStats(): IIPCCallStats[];
+
+    /**
+     * Starts recording every call handled by the server to a binary trace file.
+     * The trace can be replayed against a fresh server with bench-ipc-replay from tools/benchmarks.
+     * @param path - File to write the trace to, replaced if it exists.
+	 * @throws SyntaxError if an invalid number of parameters is given.
+	 * @throws TypeError if path is not a string.
+	 * @throws Error if the trace file could not be opened.
+     */
+	startTrace(path: string): void;
+
+    /**
+     * Stops recording calls and closes the trace file.
+     */
+	stopTrace(): void;
+}
+
+export type EIPCValueType = 'null' | 'float' | 'double' | 'int32' | 'int64' | 'uint32' | 'uint64' | 'string' | 'binary';
+
+export interface IIPCValue {
+    type: EIPCValueType;
+    value: number | string | ArrayBufferView;
+}
+
+export interface IIPCBatchCall {
+    collection: string;
+    func: string;
+    args?: IIPCValue[];
+}
+
+export interface IIPCStartupTiming {
+    spawnMs: number;
+    readyMs: number;
+    connectMs: number;
+    firstCallMs: number;
+}
+
+export interface IIPCCallStats {
+    name: string;
+    count: number;
+    totalMs: number;
+    p50Ms: number;
+    p90Ms: number;
+    p99Ms: number;
+    maxMs: number;
+    requestBytes: number;
+    responseBytes: number;
 }
  
 export interface IGlobal {
@@ -552,6 +631,14 @@ export interface IFontProperty extends IProperty {
 
 export interface IListProperty extends IProperty {
     readonly details: IListDetails;
+
+    /**
+     * Fetches a range of the list's items from the source.
+     * Used with properties fetched with a list page size, see {@link ISource#getPropertiesAsync}
+     * @param offset - Index of the first item to fetch
+     * @param count - Maximum number of items to fetch
+     */
+    getItems(offset: number, count: number): { name: string, value: string | number, enabled: boolean }[];
 }
 
 export interface IListDetails {
@@ -563,6 +650,12 @@ export interface IListDetails {
      * {@link IListProperty#format}
      */
     readonly items: { name: string, value: string | number }[];
+
+    /**
+     * Total number of items in the list. Larger than items.length
+     * when only the first page of items was fetched.
+     */
+    readonly itemCount: number;
 }
 
 export interface IEditableListProperty extends IProperty {
@@ -677,6 +770,31 @@ export interface IFactoryTypes {
     types(): string[];
 }
 
+/**
+ * Type information for sources, answered without creating a source
+ */
+export interface ISourceFactoryTypes extends IFactoryTypes {
+    /**
+     * Fetches the properties of a source type
+     * @param id - The type of source, possibly from {@link types}
+     * @returns - The properties, or null if the type has none. Properties
+     * of a type are not bound to a source, so they can't be modified.
+     */
+    getTypeProperties(id: string): IProperties;
+
+    /**
+     * Fetches the default settings of a source type
+     * @param id - The type of source, possibly from {@link types}
+     */
+    getTypeDefaults(id: string): ISettings;
+
+    /**
+     * Fetches the output flags of a source type
+     * @param id - The type of source, possibly from {@link types}
+     */
+    getTypeOutputFlags(id: string): ESourceOutputFlags;
+}
+
 export interface IReleasable {
     release(): void;
 }
@@ -853,7 +971,7 @@ export interface IService extends IConfigurable, IReleasable {
     readonly id: string;
 }
 
-export interface IFilterFactory extends IFactoryTypes {
+export interface IFilterFactory extends ISourceFactoryTypes {
     /**
      * Create an instance of an ObsFilter
      * @param id - ID of the filter, possibly returned from types()
@@ -870,7 +988,7 @@ export interface IFilterFactory extends IFactoryTypes {
 export interface IFilter extends ISource {
 }
 
-export interface IInputFactory extends IFactoryTypes {
+export interface IInputFactory extends ISourceFactoryTypes {
     /**
      * Create a new instance of an ObsInput
      * @param id - The type of input source to create, possibly from {@link types}
@@ -899,10 +1017,47 @@ export interface IInputFactory extends IFactoryTypes {
      */
     fromName(name: string): IInput;
 
+    /**
+     * Fetches the available input types without blocking the calling thread.
+     * @returns - A promise resolving to the same value as {@link types}
+     */
+    typesAsync(): Promise<string[]>;
+
     /**
      * Fetches a list of all public input sources available.
      */
     getPublicSources(): IInput[];
+
+    /**
+     * Fetches the commonly displayed state of many sources in one call
+     * @param sources - Sources to include, in order. Every public input
+     * is included when omitted.
+     * @returns - One column per field, see {@link ISourceSnapshot}
+     */
+    getSnapshot(sources?: ISource[]): ISourceSnapshot;
+}
+
+/**
+ * Columnar state of a set of sources, row i of every column describes
+ * the same source. Names and ids are indices into {@link strings}.
+ */
+export interface ISourceSnapshot {
+    readonly count: number;
+    readonly strings: string[];
+    readonly name: Uint32Array;
+    readonly id: Uint32Array;
+    readonly flags: Uint32Array;
+    readonly outputFlags: Uint32Array;
+    readonly muted: Uint8Array;
+    readonly enabled: Uint8Array;
+    readonly active: Uint8Array;
+    readonly showing: Uint8Array;
+    readonly volume: Float32Array;
+    readonly monitoringType: Int32Array;
+    readonly width: Uint32Array;
+    readonly height: Uint32Array;
+    /** Server side id of the source, the same for every snapshot of it */
+    readonly sourceId: Float64Array;
 }
 
 
@@ -1103,6 +1258,14 @@ export interface IScene extends ISource {
      */
     getItems(): ISceneItem[];
 
+    /**
+     * Fetches the transform and visibility of all items within the scene
+     * @param sinceVersion - Version of a previous snapshot, 0 for none
+     * @returns - The current version, and the state of every item unless
+     * nothing changed since sinceVersion
+     */
+    getSnapshot(sinceVersion?: number): ISceneSnapshot;
+
     /**
      * Connect a callback to a particular signal 
      * associated with this scene. 
@@ -1115,6 +1278,31 @@ export interface IScene extends ISource {
     disconnect(data: ICallbackData): void;
 }
 
+/** The state of one scene item, as returned by IScene.getSnapshot() */
+export interface ISceneItemState {
+    readonly item: ISceneItem;
+    readonly source: IInput;
+    readonly id: number;
+    readonly position: IVec2;
+    readonly rotation: number;
+    readonly scale: IVec2;
+    readonly alignment: EAlignment;
+    readonly bounds: IVec2;
+    readonly boundsType: EBoundsType;
+    readonly boundsAlignment: number;
+    readonly crop: ICropInfo;
+    readonly scaleFilter: EScaleType;
+    readonly visible: boolean;
+    readonly selected: boolean;
+}
+
+export interface ISceneSnapshot {
+    readonly version: number;
+    /** False if nothing changed since the given version, items is then left out */
+    readonly changed: boolean;
+    readonly items?: ISceneItemState[];
+}
+
 /**
  * Class representing an item within a scene. 
  * 
@@ -1201,7 +1389,7 @@ export interface ISceneItem {
     deferUpdateEnd(): void;
 }
 
-export interface ITransitionFactory extends IFactoryTypes {
+export interface ITransitionFactory extends ISourceFactoryTypes {
     /**
      * Create a new instance of an ObsTransition
      * @param id - The type of transition source to create, possibly from {@link types}
@@ -1262,7 +1450,9 @@ export interface IConfigurable {
     /**
      * Update the settings of the source instance
      * correlating to the values held within the
-     * object passed. 
+     * object passed. Keys not present in the object
+     * are left as they are, so only changed keys
+     * need to be passed.
      */
     update(settings: ISettings): void;
 
@@ -1282,6 +1472,12 @@ export interface IConfigurable {
     readonly settings: ISettings;
 }
 
+export interface ISettingsDelta {
+    settings: ISettings;
+    version: number;
+    full: boolean;
+}
+
 /**
  * Base class for Filter, Transition, Scene, and Input
  */
@@ -1299,6 +1495,22 @@ export interface ISource extends IConfigurable, IReleasable {
      */
      save(): void;
 
+    /**
+     * Fetches the properties of the source without blocking the calling thread.
+     * @param listPageSize - If set, list properties only carry up to this many
+     * items, fetch the rest with {@link IListProperty#getItems}
+     * @returns - A promise resolving to the same value as {@link properties}
+     */
+    getPropertiesAsync(listPageSize?: number): Promise<IProperties>;
+
+    /**
+     * Fetches the settings changed through {@link update} since a given version.
+     * @param version - Version returned by a previous call, 0 for all settings
+     * @returns - The changed settings and the current version. When full is
+     * set, settings holds every setting instead of only the changed ones.
+     */
+    getSettingsSince(version: number): ISettingsDelta;
+
     /**
      * The validity of the source
      */
@@ -1429,12 +1641,13 @@ export interface IVolmeter {
     /**
      * Add a callback to the volmeter. Callback will be called
      * each time volume associated with the attached source changes. 
+     * Levels are passed as one entry per channel.
      * @param cb - A callback that occurs when volume changes.
      */
     addCallback(
-        cb: (magnitude: number[],
-             peak: number[],
-             inputPeak: number[]) => void): ICallbackData;
+        cb: (magnitude: Float32Array,
+             peak: Float32Array,
+             inputPeak: Float32Array) => void): ICallbackData;
 
     /**
      * Remove a callback to prevent events from occuring immediately. 
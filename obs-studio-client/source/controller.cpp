@@ -17,14 +17,19 @@
 ******************************************************************************/
 
 #include "controller.hpp"
+#include <chrono>
 #include <codecvt>
 #include <fstream>
 #include <locale>
+#include <map>
 #include <nan.h>
 #include <sstream>
 #include <string>
+#include "error.hpp"
 #include "shared.hpp"
+#include "utility-v8.hpp"
 #include "utility.hpp"
+#include "util-server-ready.hpp"
 
 static std::string serverBinaryPath  = "";
 static std::string serverWorkingPath = "";
@@ -212,6 +217,25 @@ static void check_pid_file(std::string& pid_path)
 	close_process(pi);
 }
 
+// Created before spawning the server, which sets it once it is listening.
+static uint64_t create_ready_event(const std::string& uri)
+{
+	std::wstring name(from_utf8_to_utf16_wide(util::server_ready::event_name(uri).c_str()));
+	return reinterpret_cast<uint64_t>(CreateEventW(NULL, TRUE, FALSE, name.c_str()));
+}
+
+// Waits until the server is ready or has exited, returns true if it is ready.
+static bool wait_ready_event(uint64_t event, ProcessInfo pinfo, uint32_t timeout_ms)
+{
+	HANDLE handles[] = {reinterpret_cast<HANDLE>(event), reinterpret_cast<HANDLE>(pinfo.handle)};
+	return WaitForMultipleObjects(2, handles, FALSE, timeout_ms) == WAIT_OBJECT_0;
+}
+
+static void close_ready_event(uint64_t event)
+{
+	CloseHandle(reinterpret_cast<HANDLE>(event));
+}
+
 static void write_pid_file(std::string& pid_path, uint64_t pid)
 {
 	std::fstream::openmode mode = std::fstream::out | std::fstream::binary | std::fstream::trunc;
@@ -228,7 +252,10 @@ static void write_pid_file(std::string& pid_path, uint64_t pid)
 
 Controller::Controller() {}
 
-Controller::~Controller() {}
+Controller::~Controller()
+{
+	stop_one_way();
+}
 
 std::shared_ptr<ipc::client> Controller::host(const std::string& uri)
 {
@@ -252,13 +279,31 @@ std::shared_ptr<ipc::client> Controller::host(const std::string& uri)
 
 	check_pid_file(pid_path);
 
-	procId = spawn(serverBinaryPath, commandLine.str(), workingDirectory);
+	m_startup_timing = startup_timing_t();
+	auto begin_time  = std::chrono::high_resolution_clock::now();
+	auto elapsed_ms  = [begin_time]() {
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin_time)
+		    .count();
+	};
+
+	uint64_t ready = create_ready_event(uri);
+	procId         = spawn(serverBinaryPath, commandLine.str(), workingDirectory);
 	if (procId.id == 0) {
+		if (ready)
+			close_ready_event(ready);
 		return nullptr;
 	}
+	m_startup_timing.spawn_ms = elapsed_ms();
 
 	write_pid_file(pid_path, procId.id);
 
+	// Wait for the server to listen, connect() below still retries if the event is unavailable.
+	if (ready) {
+		wait_ready_event(ready, procId, 30000);
+		close_ready_event(ready);
+	}
+	m_startup_timing.ready_ms = elapsed_ms();
+
 	// Connect
 	std::shared_ptr<ipc::client> cl = connect(uri);
 	if (!cl) { // Assume the server broke or was not allowed to run.
@@ -267,6 +312,13 @@ std::shared_ptr<ipc::client> Controller::host(const std::string& uri)
 		kill(procId, 0, exitcode);
 		return nullptr;
 	}
+	m_startup_timing.connect_ms = elapsed_ms();
+
+	try {
+		cl->call_synchronous_helper("System", "Ping", {});
+	} catch (...) {
+	}
+	m_startup_timing.first_call_ms = elapsed_ms();
 
 	m_isServer = true;
 	return m_connection;
@@ -300,23 +352,39 @@ std::shared_ptr<ipc::client> Controller::connect(
 			}
 		}
 
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
 	}
 	if (!cl) {
 		return nullptr;
 	}
 
 	m_connection = cl;
+
+	// The server is up now, so extra connections either open right away or not at all.
+	std::unique_lock<std::mutex> ul(m_concurrent_mtx);
+	for (size_t idx = 0; idx < ConcurrentConnections; idx++) {
+		try {
+			m_concurrent_connections.push_back(std::make_shared<ipc::client>(uri));
+		} catch (...) {
+			break;
+		}
+	}
+
 	return m_connection;
 }
 
 void Controller::disconnect()
 {
+	stop_one_way();
+
 	if (m_isServer) {
 		m_connection->call_synchronous_helper("System", "Shutdown", {});
 		m_isServer = false;
 	}
 	m_connection = nullptr;
+
+	std::unique_lock<std::mutex> ul(m_concurrent_mtx);
+	m_concurrent_connections.clear();
 }
 
 std::shared_ptr<ipc::client> Controller::GetConnection()
@@ -324,6 +392,220 @@ std::shared_ptr<ipc::client> Controller::GetConnection()
 	return m_connection;
 }
 
+Controller::startup_timing_t Controller::GetStartupTiming()
+{
+	return m_startup_timing;
+}
+
+std::shared_ptr<ipc::client> Controller::GetConcurrentConnection()
+{
+	std::unique_lock<std::mutex> ul(m_concurrent_mtx);
+	if (m_concurrent_connections.empty())
+		return m_connection;
+
+	m_concurrent_next = (m_concurrent_next + 1) % m_concurrent_connections.size();
+	return m_concurrent_connections[m_concurrent_next];
+}
+
+bool Controller::call_batch(
+    const std::vector<util::ipc_batch::call_t>& calls,
+    std::vector<std::vector<ipc::value>>&       results)
+{
+	if (!m_connection)
+		return false;
+
+	std::vector<ipc::value> response =
+	    m_connection->call_synchronous_helper("Batch", "Call", {ipc::value(util::ipc_batch::write_calls(calls))});
+	if ((response.size() < 3) || ((ErrorCode)response[0].value_union.ui64 != ErrorCode::Ok))
+		return false;
+
+	return util::ipc_batch::read_results(response[2].value_bin, results);
+}
+
+bool Controller::start_trace(const std::string& path)
+{
+	flush_one_way();
+	if (!m_connection)
+		return false;
+
+	std::vector<ipc::value> response =
+	    m_connection->call_synchronous_helper("System", "StartTrace", {ipc::value(path)});
+	return (response.size() > 0) && ((ErrorCode)response[0].value_union.ui64 == ErrorCode::Ok);
+}
+
+void Controller::stop_trace()
+{
+	flush_one_way();
+	if (!m_connection)
+		return;
+
+	m_connection->call_synchronous_helper("System", "StopTrace", {});
+}
+
+void Controller::call_one_way(const std::string& cname, const std::string& fname, std::vector<ipc::value> args)
+{
+	std::unique_lock<std::mutex> ul(m_one_way_mtx);
+	m_one_way_queue.push_back({{cname, fname, std::move(args)}, 0, false});
+	m_one_way_urgent = true;
+
+	start_one_way();
+	m_one_way_cv.notify_one();
+}
+
+void Controller::call_coalesced(
+    const std::string&      cname,
+    const std::string&      fname,
+    uint64_t                uid,
+    std::vector<ipc::value> args)
+{
+	std::unique_lock<std::mutex> ul(m_one_way_mtx);
+
+	// Only the latest value per (object, property) survives until the next frame.
+	auto key = std::make_tuple(cname, fname, uid);
+	auto kv  = m_one_way_pending.find(key);
+	if (kv != m_one_way_pending.end()) {
+		m_one_way_queue[kv->second].call.args = std::move(args);
+		return;
+	}
+
+	m_one_way_pending.insert({key, m_one_way_queue.size()});
+	m_one_way_queue.push_back({{cname, fname, std::move(args)}, uid, true});
+
+	start_one_way();
+	m_one_way_cv.notify_one();
+}
+
+void Controller::flush_one_way()
+{
+	std::unique_lock<std::mutex> ul(m_one_way_mtx);
+	if (m_one_way_queue.empty() && !m_one_way_busy)
+		return;
+
+	m_one_way_urgent = true;
+	m_one_way_cv.notify_one();
+	m_one_way_idle_cv.wait(ul, [this]() { return m_one_way_queue.empty() && !m_one_way_busy; });
+}
+
+void Controller::set_one_way_error_handler(one_way_error_handler_t handler)
+{
+	// Wait for in-flight calls so the previous handler is no longer in use.
+	std::unique_lock<std::mutex> ul(m_one_way_mtx);
+	m_one_way_urgent = true;
+	m_one_way_cv.notify_one();
+	m_one_way_idle_cv.wait(ul, [this]() { return m_one_way_queue.empty() && !m_one_way_busy; });
+	m_one_way_error_handler = handler;
+}
+
+void Controller::start_one_way()
+{
+	if (m_one_way_thread.joinable())
+		return;
+
+	m_one_way_stop   = false;
+	m_one_way_thread = std::thread(&Controller::one_way_worker, this);
+}
+
+void Controller::stop_one_way()
+{
+	{
+		std::unique_lock<std::mutex> ul(m_one_way_mtx);
+		if (!m_one_way_thread.joinable())
+			return;
+		m_one_way_stop = true;
+		m_one_way_cv.notify_one();
+	}
+	m_one_way_thread.join();
+}
+
+void Controller::one_way_worker()
+{
+	auto next_frame = std::chrono::steady_clock::now();
+
+	while (true) {
+		std::vector<one_way_call_t> queue;
+		one_way_error_handler_t     error_handler;
+
+		{
+			std::unique_lock<std::mutex> ul(m_one_way_mtx);
+			m_one_way_cv.wait(ul, [this]() { return m_one_way_stop || !m_one_way_queue.empty(); });
+			if (m_one_way_queue.empty())
+				break;
+
+			// Coalesced calls are held until the next frame so repeated updates collapse into one.
+			m_one_way_cv.wait_until(ul, next_frame, [this]() { return m_one_way_stop || m_one_way_urgent; });
+
+			queue.swap(m_one_way_queue);
+			m_one_way_pending.clear();
+			m_one_way_urgent = false;
+			error_handler    = m_one_way_error_handler;
+			m_one_way_busy   = true;
+		}
+
+		next_frame = std::chrono::steady_clock::now() + std::chrono::milliseconds(OneWayFrameInterval);
+
+		// Wrap all coalesced updates of one object in a single deferred update.
+		std::map<uint64_t, size_t> last_update;
+		for (size_t idx = 0; idx < queue.size(); idx++) {
+			if (queue[idx].deferred)
+				last_update[queue[idx].uid] = idx;
+		}
+
+		std::vector<util::ipc_batch::call_t> calls;
+		calls.reserve(queue.size() + last_update.size() * 2);
+		std::map<uint64_t, bool> deferring;
+		for (size_t idx = 0; idx < queue.size(); idx++) {
+			one_way_call_t& entry = queue[idx];
+			if (entry.deferred && !deferring[entry.uid]) {
+				deferring[entry.uid] = true;
+				calls.push_back({entry.call.collection, "DeferUpdateBegin", {ipc::value(entry.uid)}});
+			}
+
+			calls.push_back(std::move(entry.call));
+
+			if (entry.deferred && (last_update[entry.uid] == idx)) {
+				calls.push_back({calls.back().collection, "DeferUpdateEnd", {ipc::value(entry.uid)}});
+			}
+		}
+
+		std::vector<std::vector<ipc::value>> results;
+		bool                                 sent = false;
+		try {
+			sent = call_batch(calls, results) && (results.size() == calls.size());
+		} catch (...) {
+			sent = false;
+		}
+
+		if (error_handler) {
+			for (size_t idx = 0; idx < calls.size(); idx++) {
+				if (!sent) {
+					error_handler(
+					    calls[idx].collection,
+					    calls[idx].function,
+					    ErrorCode::CriticalError,
+					    "Failed to make IPC call, verify IPC status.");
+					continue;
+				}
+
+				std::vector<ipc::value>& result = results[idx];
+				ErrorCode error = result.size() ? (ErrorCode)result[0].value_union.ui64 : ErrorCode::Error;
+				if (error != ErrorCode::Ok) {
+					error_handler(
+					    calls[idx].collection,
+					    calls[idx].function,
+					    error,
+					    (result.size() > 1) ? result[1].value_str : "Error without description.");
+				}
+			}
+		}
+
+		{
+			std::unique_lock<std::mutex> ul(m_one_way_mtx);
+			m_one_way_busy = false;
+		}
+		m_one_way_idle_cv.notify_all();
+	}
+}
+
 void js_setServerPath(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
 	auto isol = args.GetIsolate();
@@ -413,11 +695,296 @@ void js_host(const v8::FunctionCallbackInfo<v8::Value>& args)
 	return;
 }
 
+void js_getStartupTiming(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	Controller::startup_timing_t timing = Controller::GetInstance().GetStartupTiming();
+
+	v8::Local<v8::Object> timing_js = Nan::New<v8::Object>();
+	utilv8::SetObjectField(timing_js, "spawnMs", timing.spawn_ms);
+	utilv8::SetObjectField(timing_js, "readyMs", timing.ready_ms);
+	utilv8::SetObjectField(timing_js, "connectMs", timing.connect_ms);
+	utilv8::SetObjectField(timing_js, "firstCallMs", timing.first_call_ms);
+	args.GetReturnValue().Set(timing_js);
+}
+
 void js_disconnect(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
 	Controller::GetInstance().disconnect();
 }
 
+static bool batch_value_from_js(v8::Local<v8::Value> js, ipc::value& value)
+{
+	if (!js->IsObject())
+		return false;
+
+	v8::Local<v8::Object> obj = js.As<v8::Object>();
+	v8::Local<v8::Value>  type_js;
+	v8::Local<v8::Value>  value_js;
+	if (!Nan::Get(obj, Nan::New("type").ToLocalChecked()).ToLocal(&type_js) || !type_js->IsString())
+		return false;
+	if (!Nan::Get(obj, Nan::New("value").ToLocalChecked()).ToLocal(&value_js))
+		return false;
+
+	std::string type = *Nan::Utf8String(type_js);
+	if (type == "null") {
+		value = ipc::value();
+	} else if (type == "string") {
+		value = ipc::value(std::string(*Nan::Utf8String(value_js)));
+	} else if (type == "binary") {
+		if (!value_js->IsArrayBufferView())
+			return false;
+		auto              view = value_js.As<v8::ArrayBufferView>();
+		std::vector<char> buf(view->ByteLength());
+		view->CopyContents(buf.data(), buf.size());
+		value = ipc::value(buf);
+	} else {
+		if (!value_js->IsNumber())
+			return false;
+		double number = value_js.As<v8::Number>()->Value();
+		if (type == "float") {
+			value = ipc::value(float(number));
+		} else if (type == "double") {
+			value = ipc::value(number);
+		} else if (type == "int32") {
+			value = ipc::value(int32_t(number));
+		} else if (type == "int64") {
+			value = ipc::value(int64_t(number));
+		} else if (type == "uint32") {
+			value = ipc::value(uint32_t(number));
+		} else if (type == "uint64") {
+			value = ipc::value(uint64_t(number));
+		} else {
+			return false;
+		}
+	}
+	return true;
+}
+
+static v8::Local<v8::Value> batch_value_to_js(const ipc::value& value)
+{
+	switch (value.type) {
+	case ipc::type::Float:
+		return Nan::New<v8::Number>(value.value_union.fp32);
+	case ipc::type::Double:
+		return Nan::New<v8::Number>(value.value_union.fp64);
+	case ipc::type::Int32:
+		return Nan::New<v8::Number>(value.value_union.i32);
+	case ipc::type::Int64:
+		return Nan::New<v8::Number>(double(value.value_union.i64));
+	case ipc::type::UInt32:
+		return Nan::New<v8::Number>(value.value_union.ui32);
+	case ipc::type::UInt64:
+		return Nan::New<v8::Number>(double(value.value_union.ui64));
+	case ipc::type::String:
+		return Nan::New<v8::String>(value.value_str).ToLocalChecked();
+	case ipc::type::Binary: {
+		auto buf = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), value.value_bin.size());
+		if (value.value_bin.size() > 0)
+			memcpy(buf->GetContents().Data(), value.value_bin.data(), value.value_bin.size());
+		return v8::Uint8Array::New(buf, 0, value.value_bin.size());
+	}
+	default:
+		return Nan::Null();
+	}
+}
+
+void js_callBatch(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	auto isol = args.GetIsolate();
+	if (args.Length() != 1) {
+		isol->ThrowException(v8::Exception::SyntaxError(
+		    Nan::New<v8::String>("Invalid number of arguments, usage: callBatch(<array> calls).").ToLocalChecked()));
+		return;
+	} else if (!args[0]->IsArray()) {
+		isol->ThrowException(v8::Exception::TypeError(
+		    Nan::New<v8::String>("Argument 'calls' must be of type 'Array'.").ToLocalChecked()));
+		return;
+	}
+
+	v8::Local<v8::Array>                 calls_js = args[0].As<v8::Array>();
+	std::vector<util::ipc_batch::call_t> calls(calls_js->Length());
+	for (uint32_t idx = 0; idx < calls_js->Length(); idx++) {
+		v8::Local<v8::Value> call_js = Nan::Get(calls_js, idx).ToLocalChecked();
+		v8::Local<v8::Value> collection_js, function_js, args_js;
+		if (!call_js->IsObject()
+		    || !Nan::Get(call_js.As<v8::Object>(), Nan::New("collection").ToLocalChecked()).ToLocal(&collection_js)
+		    || !Nan::Get(call_js.As<v8::Object>(), Nan::New("func").ToLocalChecked()).ToLocal(&function_js)
+		    || !Nan::Get(call_js.As<v8::Object>(), Nan::New("args").ToLocalChecked()).ToLocal(&args_js)
+		    || !collection_js->IsString() || !function_js->IsString()) {
+			isol->ThrowException(v8::Exception::TypeError(
+			    Nan::New<v8::String>("Each call must have a 'collection' and 'func' string.").ToLocalChecked()));
+			return;
+		}
+
+		calls[idx].collection = *Nan::Utf8String(collection_js);
+		calls[idx].function   = *Nan::Utf8String(function_js);
+		if (args_js->IsArray()) {
+			v8::Local<v8::Array> values_js = args_js.As<v8::Array>();
+			calls[idx].args.resize(values_js->Length());
+			for (uint32_t arg = 0; arg < values_js->Length(); arg++) {
+				if (!batch_value_from_js(Nan::Get(values_js, arg).ToLocalChecked(), calls[idx].args[arg])) {
+					isol->ThrowException(v8::Exception::TypeError(
+					    Nan::New<v8::String>("Each argument must be an object with a valid 'type' and 'value'.")
+					        .ToLocalChecked()));
+					return;
+				}
+			}
+		}
+	}
+
+	// call_batch doesn't flush itself, the one-way worker sends its queue with it.
+	Controller::GetInstance().flush_one_way();
+
+	std::vector<std::vector<ipc::value>> results;
+	if (!Controller::GetInstance().call_batch(calls, results)) {
+		isol->ThrowException(
+		    v8::Exception::Error(Nan::New<v8::String>("Failed to run batched calls.").ToLocalChecked()));
+		return;
+	}
+
+	v8::Local<v8::Array> results_js = Nan::New<v8::Array>(uint32_t(results.size()));
+	for (uint32_t idx = 0; idx < results.size(); idx++) {
+		v8::Local<v8::Array> values_js = Nan::New<v8::Array>(uint32_t(results[idx].size()));
+		for (uint32_t val = 0; val < results[idx].size(); val++) {
+			Nan::Set(values_js, val, batch_value_to_js(results[idx][val]));
+		}
+		Nan::Set(results_js, idx, values_js);
+	}
+	args.GetReturnValue().Set(results_js);
+}
+
+void js_getCallStats(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	auto isol = args.GetIsolate();
+	auto conn = Controller::GetInstance().GetConnection();
+	if (!conn) {
+		isol->ThrowException(
+		    v8::Exception::Error(Nan::New<v8::String>("Failed to obtain IPC connection.").ToLocalChecked()));
+		return;
+	}
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper("System", "GetCallStats", {});
+	if (!ValidateResponse(response))
+		return;
+
+	// Each function is reported as name, count, total, p50, p90, p99, max,
+	//  request bytes and response bytes. Times are in nanoseconds.
+	const size_t         fields   = 9;
+	uint32_t             count    = response[1].value_union.ui32;
+	v8::Local<v8::Array> stats_js = Nan::New<v8::Array>();
+	for (uint32_t idx = 0, out = 0; idx < count; idx++) {
+		size_t base = 2 + idx * fields;
+		if (response.size() < base + fields)
+			break;
+
+		// Skip functions that were never called to keep the list short.
+		if (response[base + 1].value_union.ui64 == 0)
+			continue;
+
+		v8::Local<v8::Object> entry = Nan::New<v8::Object>();
+		utilv8::SetObjectField(entry, "name", response[base].value_str);
+		utilv8::SetObjectField(entry, "count", double(response[base + 1].value_union.ui64));
+		utilv8::SetObjectField(entry, "totalMs", double(response[base + 2].value_union.ui64) / 1000000.0);
+		utilv8::SetObjectField(entry, "p50Ms", double(response[base + 3].value_union.ui64) / 1000000.0);
+		utilv8::SetObjectField(entry, "p90Ms", double(response[base + 4].value_union.ui64) / 1000000.0);
+		utilv8::SetObjectField(entry, "p99Ms", double(response[base + 5].value_union.ui64) / 1000000.0);
+		utilv8::SetObjectField(entry, "maxMs", double(response[base + 6].value_union.ui64) / 1000000.0);
+		utilv8::SetObjectField(entry, "requestBytes", double(response[base + 7].value_union.ui64));
+		utilv8::SetObjectField(entry, "responseBytes", double(response[base + 8].value_union.ui64));
+		Nan::Set(stats_js, out++, entry);
+	}
+	args.GetReturnValue().Set(stats_js);
+}
+
+void js_startTrace(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	auto isol = args.GetIsolate();
+	if (args.Length() != 1) {
+		isol->ThrowException(v8::Exception::SyntaxError(
+		    Nan::New<v8::String>("Invalid number of arguments, usage: startTrace(<string> path).").ToLocalChecked()));
+		return;
+	} else if (!args[0]->IsString()) {
+		isol->ThrowException(v8::Exception::TypeError(
+		    Nan::New<v8::String>("Argument 'path' must be of type 'String'.").ToLocalChecked()));
+		return;
+	}
+
+	if (!Controller::GetInstance().start_trace(*Nan::Utf8String(args[0]))) {
+		isol->ThrowException(
+		    v8::Exception::Error(Nan::New<v8::String>("Failed to start IPC trace.").ToLocalChecked()));
+		return;
+	}
+}
+
+void js_stopTrace(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	Controller::GetInstance().stop_trace();
+}
+
+struct DeferredError
+{
+	std::string collection;
+	std::string function;
+	ErrorCode   error;
+	std::string message;
+};
+typedef utilv8::managed_callback<std::shared_ptr<DeferredError>> DeferredErrorCallback;
+
+static DeferredErrorCallback* deferredErrorAsync = nullptr;
+static Nan::Callback          deferredErrorFunction;
+
+static void deferred_error_handler(void* data, std::shared_ptr<DeferredError> item)
+{
+	v8::Local<v8::Value> args[] = {Nan::New<v8::String>(item->collection).ToLocalChecked(),
+	                               Nan::New<v8::String>(item->function).ToLocalChecked(),
+	                               Nan::New<v8::Number>(double(item->error)),
+	                               Nan::New<v8::String>(item->message).ToLocalChecked()};
+
+	Nan::Call(deferredErrorFunction, 4, args);
+}
+
+void js_setDeferredErrorCallback(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	auto isol = args.GetIsolate();
+	if (args.Length() != 1) {
+		isol->ThrowException(v8::Exception::SyntaxError(
+		    Nan::New<v8::String>("Invalid number of arguments, usage: setDeferredErrorCallback(<function> callback).")
+		        .ToLocalChecked()));
+		return;
+	} else if (!args[0]->IsFunction() && !args[0]->IsNullOrUndefined()) {
+		isol->ThrowException(v8::Exception::TypeError(
+		    Nan::New<v8::String>("Argument 'callback' must be of type 'Function' or null.").ToLocalChecked()));
+		return;
+	}
+
+	// Stop reporting before the runner goes away.
+	Controller::GetInstance().set_one_way_error_handler(nullptr);
+	if (deferredErrorAsync) {
+		deferredErrorAsync->clear();
+		deferredErrorAsync->finalize();
+		deferredErrorAsync = nullptr;
+	}
+	deferredErrorFunction.Reset();
+
+	if (!args[0]->IsFunction())
+		return;
+
+	deferredErrorFunction.Reset(args[0].As<v8::Function>());
+	deferredErrorAsync = new DeferredErrorCallback();
+	deferredErrorAsync->set_handler(deferred_error_handler, nullptr);
+
+	DeferredErrorCallback* async = deferredErrorAsync;
+	Controller::GetInstance().set_one_way_error_handler(
+	    [async](const std::string& cname, const std::string& fname, ErrorCode error, const std::string& message) {
+		    std::shared_ptr<DeferredError> item = std::make_shared<DeferredError>();
+		    item->collection                    = cname;
+		    item->function                      = fname;
+		    item->error                         = error;
+		    item->message                       = message;
+		    async->queue(std::move(item));
+	    });
+}
+
 INITIALIZER(js_ipc)
 {
 	initializerFunctions.push([](v8::Local<v8::Object> exports) {
@@ -427,6 +994,12 @@ INITIALIZER(js_ipc)
 		NODE_SET_METHOD(obj, "connect", js_connect);
 		NODE_SET_METHOD(obj, "host", js_host);
 		NODE_SET_METHOD(obj, "disconnect", js_disconnect);
+		NODE_SET_METHOD(obj, "getStartupTiming", js_getStartupTiming);
+		NODE_SET_METHOD(obj, "callBatch", js_callBatch);
+		NODE_SET_METHOD(obj, "setDeferredErrorCallback", js_setDeferredErrorCallback);
+		NODE_SET_METHOD(obj, "getCallStats", js_getCallStats);
+		NODE_SET_METHOD(obj, "startTrace", js_startTrace);
+		NODE_SET_METHOD(obj, "stopTrace", js_stopTrace);
 		exports->Set(v8::String::NewFromUtf8(exports->GetIsolate(), "IPC"), obj);
 	});
 }
@@ -17,9 +17,18 @@
 ******************************************************************************/
 
 #pragma once
+#include <condition_variable>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "error.hpp"
 #include "ipc-client.hpp"
+#include "util-ipc-batch.hpp"
 
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -71,8 +80,93 @@ class Controller
 
 	std::shared_ptr<ipc::client> GetConnection();
 
+	// Milliseconds from the start of host() until each startup step finished.
+	struct startup_timing_t
+	{
+		double spawn_ms      = 0;
+		double ready_ms      = 0;
+		double connect_ms    = 0;
+		double first_call_ms = 0;
+	};
+	startup_timing_t GetStartupTiming();
+
+	// Returns one of a few extra connections for functions the server declared
+	//  concurrent. The ipc library serves every connection on its own thread
+	//  (see the note in the top-level CMakeLists.txt), so these calls do not
+	//  wait behind slow calls on the main connection.
+	//  Falls back to the main connection if no extra connection is open.
+	std::shared_ptr<ipc::client> GetConcurrentConnection();
+
+	// Runs all calls in order in a single round trip. On success 'results'
+	//  holds one result list per call, exactly as a single call returns it.
+	//  Does not flush one-way calls, callers other than the one-way worker must.
+	bool call_batch(
+	    const std::vector<util::ipc_batch::call_t>& calls,
+	    std::vector<std::vector<ipc::value>>&       results);
+
+	// One-way calls return immediately. A background thread sends everything
+	//  queued so far as one batch and reports failures to the error handler
+	//  instead of the caller. GetConnection() in utility.hpp flushes the queue
+	//  so synchronous calls always observe earlier one-way calls.
+	typedef std::function<void(
+	    const std::string& cname, const std::string& fname, ErrorCode error, const std::string& message)>
+	    one_way_error_handler_t;
+
+	void call_one_way(const std::string& cname, const std::string& fname, std::vector<ipc::value> args);
+
+	// Coalesced calls are one-way calls that keep only the latest arguments
+	//  per (cname, fname, uid) and are sent once per frame. All coalesced
+	//  calls for the same uid are wrapped in cname's DeferUpdateBegin and
+	//  DeferUpdateEnd, so the server applies them as a single update.
+	void call_coalesced(
+	    const std::string&      cname,
+	    const std::string&      fname,
+	    uint64_t                uid,
+	    std::vector<ipc::value> args);
+	void flush_one_way();
+	void set_one_way_error_handler(one_way_error_handler_t handler);
+
+	// Records every call the server handles to a binary trace file, see
+	//  util-ipc-trace.hpp. The server can also be started with the
+	//  OSN_IPC_TRACE environment variable set to trace from the first call.
+	bool start_trace(const std::string& path);
+	void stop_trace();
+
 	private:
+	struct one_way_call_t
+	{
+		util::ipc_batch::call_t call;
+		uint64_t                uid;
+		bool                    deferred;
+	};
+	typedef std::tuple<std::string, std::string, uint64_t> one_way_key_t;
+
+	// Coalesced calls are sent at most once per frame at 60 fps.
+	static const uint32_t OneWayFrameInterval = 16;
+
+	void one_way_worker();
+	void start_one_way();
+	void stop_one_way();
+
+	static const size_t ConcurrentConnections = 2;
+
 	bool                         m_isServer = false;
 	std::shared_ptr<ipc::client> m_connection;
 	ProcessInfo                  procId;
+	startup_timing_t             m_startup_timing;
+
+	std::mutex                                m_concurrent_mtx;
+	std::vector<std::shared_ptr<ipc::client>> m_concurrent_connections;
+	size_t                                    m_concurrent_next = 0;
+
+	std::thread                     m_one_way_thread;
+	std::mutex                      m_one_way_mtx;
+	std::condition_variable         m_one_way_cv;
+	std::condition_variable         m_one_way_idle_cv;
+	std::vector<one_way_call_t>     m_one_way_queue;
+	std::map<one_way_key_t, size_t> m_one_way_pending;
+	bool                            m_one_way_busy   = false;
+	bool                            m_one_way_stop   = false;
+	bool                            m_one_way_urgent = false;
+	one_way_error_handler_t         m_one_way_error_handler;
 };
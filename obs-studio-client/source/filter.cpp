@@ -42,6 +42,9 @@ void osn::Filter::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 
 	// Class Template
 	utilv8::SetTemplateField(fnctemplate, "types", Types);
+	utilv8::SetTemplateField(fnctemplate, "getTypeProperties", osn::ISource::GetTypeProperties);
+	utilv8::SetTemplateField(fnctemplate, "getTypeDefaults", osn::ISource::GetTypeDefaults);
+	utilv8::SetTemplateField(fnctemplate, "getTypeOutputFlags", osn::ISource::GetTypeOutputFlags);
 	utilv8::SetTemplateField(fnctemplate, "create", Create);
 
 	// Stuff
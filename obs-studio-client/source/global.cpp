@@ -121,7 +121,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::Global::getOutputFlagsFromId(Nan::NAN_METHOD_AR
 
 Nan::NAN_METHOD_RETURN_TYPE osn::Global::laggedFrames(Nan::NAN_METHOD_ARGS_TYPE info)
 {
-	auto conn = GetConnection();
+	auto conn = GetConcurrentConnection();
 	if (!conn)
 		return;
 
@@ -135,7 +135,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::Global::laggedFrames(Nan::NAN_METHOD_ARGS_TYPE
 
 Nan::NAN_METHOD_RETURN_TYPE osn::Global::totalFrames(Nan::NAN_METHOD_ARGS_TYPE info)
 {
-	auto conn = GetConnection();
+	auto conn = GetConcurrentConnection();
 	if (!conn)
 		return;
 
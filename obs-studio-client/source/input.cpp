@@ -18,6 +18,7 @@
 
 #include "input.hpp"
 #include <condition_variable>
+#include <cstring>
 #include <mutex>
 #include <string>
 #include "controller.hpp"
@@ -43,10 +44,15 @@ void osn::Input::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 
 	// Function Template
 	utilv8::SetTemplateField(fnctemplate, "types", Types);
+	utilv8::SetTemplateField(fnctemplate, "getTypeProperties", osn::ISource::GetTypeProperties);
+	utilv8::SetTemplateField(fnctemplate, "getTypeDefaults", osn::ISource::GetTypeDefaults);
+	utilv8::SetTemplateField(fnctemplate, "getTypeOutputFlags", osn::ISource::GetTypeOutputFlags);
+	utilv8::SetTemplateField(fnctemplate, "typesAsync", TypesAsync);
 	utilv8::SetTemplateField(fnctemplate, "create", Create);
 	utilv8::SetTemplateField(fnctemplate, "createPrivate", CreatePrivate);
 	utilv8::SetTemplateField(fnctemplate, "fromName", FromName);
 	utilv8::SetTemplateField(fnctemplate, "getPublicSources", GetPublicSources);
+	utilv8::SetTemplateField(fnctemplate, "getSnapshot", GetSnapshot);
 
 	// Prototype Template
 
@@ -77,6 +83,20 @@ void osn::Input::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 	prototype.Reset(fnctemplate);
 }
 
+static v8::Local<v8::Value> TypesFromResponse(std::vector<ipc::value>& response, v8::Local<v8::Object>)
+{
+	if (!ValidateResponse(response))
+		return v8::Local<v8::Value>();
+
+	std::vector<std::string> types;
+
+	for (size_t i = 1; i < response.size(); i++) {
+		types.push_back(response[i].value_str);
+	}
+
+	return utilv8::ToValue<std::string>(types);
+}
+
 Nan::NAN_METHOD_RETURN_TYPE osn::Input::Types(Nan::NAN_METHOD_ARGS_TYPE info)
 {
 	// Function takes no parameters.
@@ -88,16 +108,19 @@ Nan::NAN_METHOD_RETURN_TYPE osn::Input::Types(Nan::NAN_METHOD_ARGS_TYPE info)
 
 	std::vector<ipc::value> response = conn->call_synchronous_helper("Input", "Types", {});
 
-	if (!ValidateResponse(response))
+	v8::Local<v8::Value> types = TypesFromResponse(response, info.This());
+	if (types.IsEmpty())
 		return;
 
-	std::vector<std::string> types;
+	info.GetReturnValue().Set(types);
+}
 
-	for (size_t i = 1; i < response.size(); i++) {
-		types.push_back(response[i].value_str);
-	}
+Nan::NAN_METHOD_RETURN_TYPE osn::Input::TypesAsync(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	// Function takes no parameters.
+	ASSERT_INFO_LENGTH(info, 0);
 
-	info.GetReturnValue().Set(utilv8::ToValue<std::string>(types));
+	info.GetReturnValue().Set(utility::CallAsync("Input", "Types", {}, TypesFromResponse));
 }
 
 Nan::NAN_METHOD_RETURN_TYPE osn::Input::Create(Nan::NAN_METHOD_ARGS_TYPE info)
@@ -246,6 +269,79 @@ Nan::NAN_METHOD_RETURN_TYPE osn::Input::GetPublicSources(Nan::NAN_METHOD_ARGS_TY
 	info.GetReturnValue().Set(arr);
 }
 
+Nan::NAN_METHOD_RETURN_TYPE osn::Input::GetSnapshot(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	std::vector<ipc::value> args;
+	if (info.Length() > 0 && !info[0]->IsUndefined()) {
+		v8::Local<v8::Array> sources;
+		ASSERT_GET_VALUE(info[0], sources);
+
+		std::vector<char> ids(sources->Length() * sizeof(uint64_t));
+		for (uint32_t idx = 0; idx < sources->Length(); idx++) {
+			v8::Local<v8::Value> value = Nan::Get(sources, idx).ToLocalChecked();
+			osn::ISource*        source = nullptr;
+			if (!value->IsObject() || !osn::ISource::Retrieve(value->ToObject(), source)) {
+				Nan::ThrowTypeError("Expected an array of sources.");
+				return;
+			}
+			memcpy(ids.data() + idx * sizeof(uint64_t), &source->sourceId, sizeof(uint64_t));
+		}
+		args.push_back(ipc::value(ids));
+	}
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper("Input", "GetSnapshot", args);
+
+	if (!ValidateResponse(response))
+		return;
+
+	// Names and type ids are indices into the string table, which holds
+	//  null terminated strings back to back.
+	const std::vector<char>& table   = response[2].value_bin;
+	v8::Local<v8::Array>     strings = Nan::New<v8::Array>();
+	for (size_t offset = 0, idx = 0; offset < table.size(); idx++) {
+		size_t length = strnlen(table.data() + offset, table.size() - offset);
+		Nan::Set(strings, uint32_t(idx), Nan::New<v8::String>(table.data() + offset, int(length)).ToLocalChecked());
+		offset += length + 1;
+	}
+
+	v8::Local<v8::Object> snapshot = Nan::New<v8::Object>();
+	utilv8::SetObjectField(snapshot, "count", response[1].value_union.ui32);
+	utilv8::SetObjectField(snapshot, "strings", strings);
+	utilv8::SetObjectField(snapshot, "name", utilv8::ToTypedArray<v8::Uint32Array, uint32_t>(response[3].value_bin));
+	utilv8::SetObjectField(snapshot, "id", utilv8::ToTypedArray<v8::Uint32Array, uint32_t>(response[4].value_bin));
+	utilv8::SetObjectField(snapshot, "flags", utilv8::ToTypedArray<v8::Uint32Array, uint32_t>(response[5].value_bin));
+	utilv8::SetObjectField(
+	    snapshot, "outputFlags", utilv8::ToTypedArray<v8::Uint32Array, uint32_t>(response[6].value_bin));
+	utilv8::SetObjectField(snapshot, "muted", utilv8::ToTypedArray<v8::Uint8Array, uint8_t>(response[7].value_bin));
+	utilv8::SetObjectField(snapshot, "enabled", utilv8::ToTypedArray<v8::Uint8Array, uint8_t>(response[8].value_bin));
+	utilv8::SetObjectField(snapshot, "active", utilv8::ToTypedArray<v8::Uint8Array, uint8_t>(response[9].value_bin));
+	utilv8::SetObjectField(snapshot, "showing", utilv8::ToTypedArray<v8::Uint8Array, uint8_t>(response[10].value_bin));
+	utilv8::SetObjectField(snapshot, "volume", utilv8::ToTypedArray<v8::Float32Array, float_t>(response[11].value_bin));
+	utilv8::SetObjectField(
+	    snapshot, "monitoringType", utilv8::ToTypedArray<v8::Int32Array, int32_t>(response[12].value_bin));
+	utilv8::SetObjectField(snapshot, "width", utilv8::ToTypedArray<v8::Uint32Array, uint32_t>(response[13].value_bin));
+	utilv8::SetObjectField(snapshot, "height", utilv8::ToTypedArray<v8::Uint32Array, uint32_t>(response[14].value_bin));
+
+	// Source ids are generation << 32 | index, which is exact as a double while
+	//  the slot generation stays below 2^21, and avoids BigInt on the JavaScript side.
+	const std::vector<char>& packed_ids = response[15].value_bin;
+	size_t                   id_count   = packed_ids.size() / sizeof(uint64_t);
+	std::vector<char>        source_ids(id_count * sizeof(double_t));
+	for (size_t idx = 0; idx < id_count; idx++) {
+		uint64_t uid;
+		memcpy(&uid, packed_ids.data() + idx * sizeof(uint64_t), sizeof(uint64_t));
+		double_t value = double_t(uid);
+		memcpy(source_ids.data() + idx * sizeof(double_t), &value, sizeof(double_t));
+	}
+	utilv8::SetObjectField(snapshot, "sourceId", utilv8::ToTypedArray<v8::Float64Array, double_t>(source_ids));
+
+	info.GetReturnValue().Set(snapshot);
+}
+
 Nan::NAN_METHOD_RETURN_TYPE osn::Input::Duplicate(Nan::NAN_METHOD_ARGS_TYPE info)
 {
 	osn::ISource* baseobj = nullptr;
@@ -430,17 +526,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::Input::SetVolume(Nan::NAN_METHOD_ARGS_TYPE info
 	ASSERT_INFO_LENGTH(info, 1);
 	ASSERT_GET_VALUE(info[0], volume);
 
-	auto conn = GetConnection();
-	if (!conn)
-		return;
-
-	std::vector<ipc::value> response =
-	    conn->call_synchronous_helper("Input", "SetVolume", {ipc::value(obj->sourceId), ipc::value(volume)});
-
-	if (!ValidateResponse(response))
-		return;
-
-	info.GetReturnValue().Set(response[1].value_union.fp32);
+	Controller::GetInstance().call_one_way("Input", "SetVolume", {ipc::value(obj->sourceId), ipc::value(volume)});
 }
 
 Nan::NAN_METHOD_RETURN_TYPE osn::Input::GetSyncOffset(Nan::NAN_METHOD_ARGS_TYPE info)
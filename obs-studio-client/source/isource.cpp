@@ -18,14 +18,26 @@
 
 #include "isource.hpp"
 #include <error.hpp>
+#include <cmath>
 #include <functional>
+#include <map>
 #include "controller.hpp"
 #include "obs-property.hpp"
 #include "properties.hpp"
 #include "shared.hpp"
+#include "util-data-binary.hpp"
 #include "utility-v8.hpp"
 #include "utility.hpp"
 
+// Last properties received for each source. The server only sends the hash back when it matches
+//  the one we already hold, in which case the cached map is reused as is.
+struct property_cache_t
+{
+	uint64_t                             hash = 0;
+	std::shared_ptr<osn::property_map_t> properties;
+};
+static std::map<uint64_t, property_cache_t> property_cache;
+
 Nan::Persistent<v8::FunctionTemplate> osn::ISource::prototype = Nan::Persistent<v8::FunctionTemplate>();
 osn::ISource*                         sourceObject;
 
@@ -45,8 +57,10 @@ void osn::ISource::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 
 	utilv8::SetTemplateAccessorProperty(objtemplate, "configurable", IsConfigurable);
 	utilv8::SetTemplateAccessorProperty(objtemplate, "properties", GetProperties);
+	utilv8::SetTemplateField(objtemplate, "getPropertiesAsync", GetPropertiesAsync);
 	utilv8::SetTemplateAccessorProperty(objtemplate, "settings", GetSettings);
 	utilv8::SetTemplateField(objtemplate, "update", Update);
+	utilv8::SetTemplateField(objtemplate, "getSettingsSince", GetSettingsSince);
 	utilv8::SetTemplateField(objtemplate, "load", Load);
 	utilv8::SetTemplateField(objtemplate, "save", Save);
 
@@ -78,6 +92,8 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::Release(Nan::NAN_METHOD_ARGS_TYPE info
 
 	if (!ValidateResponse(response))
 		return;
+
+	property_cache.erase(obj->sourceId);
 }
 
 Nan::NAN_METHOD_RETURN_TYPE osn::ISource::Remove(Nan::NAN_METHOD_ARGS_TYPE info)
@@ -96,6 +112,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::Remove(Nan::NAN_METHOD_ARGS_TYPE info)
 	if (!ValidateResponse(response))
 		return;
 
+	property_cache.erase(is->sourceId);
 	is->sourceId = UINT64_MAX;
 	return;
 }
@@ -121,34 +138,26 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::IsConfigurable(Nan::NAN_METHOD_ARGS_TY
 	return;
 }
 
-Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetProperties(Nan::NAN_METHOD_ARGS_TYPE info)
+static uint64_t CachedPropertiesHash(uint64_t sourceId)
 {
-	osn::ISource* hndl = nullptr;
-	if (!utilv8::SafeUnwrap<osn::ISource>(info, hndl)) {
-		return;
-	}
-
-	auto conn = GetConnection();
-	if (!conn)
-		return;
-
-	std::vector<ipc::value> response =
-	    conn->call_synchronous_helper("Source", "GetProperties", {ipc::value(hndl->sourceId)});
-
-	if (!ValidateResponse(response))
-		return;
+	auto found = property_cache.find(sourceId);
+	return (found != property_cache.end()) ? found->second.hash : 0;
+}
 
-	if (response.size() == 1) {
-		info.GetReturnValue().Set(Nan::Null());
-		return;
-	}
+// The whole sheet arrives as one buffer, read it one property at a time.
+static osn::property_map_t PropertyMapFromBuffer(const std::vector<char>& buffer)
+{
+	obs::PropertyListReader reader(buffer);
+
+	osn::property_map_t            pmap;
+	std::shared_ptr<obs::Property> raw_property;
+	size_t                         idx = 0;
+	while (reader.next(raw_property)) {
+		if (!raw_property) {
+			continue;
+		}
 
-	// Parse the massive structure of properties we were just sent.
-	osn::property_map_t pmap;
-	for (size_t idx = 1; idx < response.size(); ++idx) {
 		// !FIXME! Use the already existing obs::Property object instead of copying data.
-		auto raw_property = obs::Property::deserialize(response[idx].value_bin);
-
 		std::shared_ptr<osn::Property> pr;
 
 		switch (raw_property->type()) {
@@ -198,6 +207,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetProperties(Nan::NAN_METHOD_ARGS_TYP
 			std::shared_ptr<osn::ListProperty> pr2 = std::make_shared<osn::ListProperty>();
 			pr2->field_type                        = osn::ListProperty::Type(cast_property->field_type);
 			pr2->item_format                       = osn::ListProperty::Format(cast_property->format);
+			pr2->item_count                        = cast_property->item_count;
 			for (auto& item : cast_property->items) {
 				osn::ListProperty::Item item2;
 				item2.name     = item.name;
@@ -246,7 +256,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetProperties(Nan::NAN_METHOD_ARGS_TYP
 				option2.description = option.description;
 				pr2->options.push_back(std::move(option2));
 			}
-
+			pr = std::static_pointer_cast<osn::Property>(pr2);
 			break;
 		}
 		default: {
@@ -263,14 +273,294 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetProperties(Nan::NAN_METHOD_ARGS_TYP
 			pr->enabled          = raw_property->enabled;
 			pr->visible          = raw_property->visible;
 
-			pmap.emplace(idx - 1, pr);
+			pmap.emplace(idx++, pr);
 		}
 	}
 
-	// obj = std::move(pmap);
-	osn::Properties* props = new osn::Properties(std::move(pmap), info.This());
-	info.GetReturnValue().Set(osn::Properties::Store(props));
-	return;
+	return pmap;
+}
+
+static v8::Local<v8::Value> PropertiesFromResponse(std::vector<ipc::value>& response, v8::Local<v8::Object> source)
+{
+	if (!ValidateResponse(response))
+		return v8::Local<v8::Value>();
+
+	osn::ISource* is = nullptr;
+	if (!osn::ISource::Retrieve(source, is) || (response.size() < 2)) {
+		return Nan::Null();
+	}
+
+	uint64_t hash  = response[1].value_union.ui64;
+	auto     found = property_cache.find(is->sourceId);
+	if (response.size() == 2) {
+		if ((found == property_cache.end()) || (found->second.hash != hash) || found->second.properties->empty()) {
+			return Nan::Null();
+		}
+		return osn::Properties::Store(new osn::Properties(found->second.properties, source));
+	}
+
+	osn::property_map_t pmap = PropertyMapFromBuffer(response[2].value_bin);
+	if (pmap.empty()) {
+		property_cache[is->sourceId] = {hash, std::make_shared<osn::property_map_t>()};
+		return Nan::Null();
+	}
+
+	auto properties              = std::make_shared<osn::property_map_t>(std::move(pmap));
+	property_cache[is->sourceId] = {hash, properties};
+
+	osn::Properties* props = new osn::Properties(properties, source);
+	return osn::Properties::Store(props);
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetProperties(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	osn::ISource* hndl = nullptr;
+	if (!utilv8::SafeUnwrap<osn::ISource>(info, hndl)) {
+		return;
+	}
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper(
+	    "Source", "GetProperties", {ipc::value(hndl->sourceId), ipc::value(CachedPropertiesHash(hndl->sourceId))});
+
+	v8::Local<v8::Value> props = PropertiesFromResponse(response, info.This());
+	if (props.IsEmpty())
+		return;
+
+	info.GetReturnValue().Set(props);
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetPropertiesAsync(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	osn::ISource* hndl = nullptr;
+	if (!utilv8::SafeUnwrap<osn::ISource>(info, hndl)) {
+		return;
+	}
+
+	std::vector<ipc::value> args = {ipc::value(hndl->sourceId), ipc::value(CachedPropertiesHash(hndl->sourceId))};
+
+	// With a page size, list properties only carry their first items, the rest is fetched with getItems().
+	if (info.Length() > 0 && info[0]->IsNumber()) {
+		uint32_t list_page_size;
+		ASSERT_GET_VALUE(info[0], list_page_size);
+		args.push_back(ipc::value(list_page_size));
+	}
+
+	info.GetReturnValue().Set(
+	    utility::CallAsync("Source", "GetProperties", std::move(args), PropertiesFromResponse, info.This()));
+}
+
+// Settings travel as util::data_binary instead of JSON text, which saves
+//  stringifying on this side and parsing on the server (and the reverse).
+// Only what JSON.stringify would have kept is encoded: null, undefined and
+//  functions are skipped and arrays only carry their object elements, as
+//  obs_data arrays can't hold anything else.
+static void EncodeSettings(v8::Local<v8::Object> object, util::data_binary::writer& writer)
+{
+	using util::data_binary::type;
+
+	size_t   offset = writer.begin_count();
+	uint32_t count  = 0;
+
+	v8::Local<v8::Array> keys = Nan::GetOwnPropertyNames(object).ToLocalChecked();
+	for (uint32_t idx = 0; idx < keys->Length(); idx++) {
+		v8::Local<v8::Value> key   = Nan::Get(keys, idx).ToLocalChecked();
+		v8::Local<v8::Value> value = Nan::Get(object, key).ToLocalChecked();
+		v8::String::Utf8Value name(key);
+
+		if (value->IsBoolean()) {
+			writer.key(*name, size_t(name.length()), type::Bool);
+			writer.value_bool(Nan::To<bool>(value).FromJust());
+		} else if (value->IsNumber()) {
+			double_t number = Nan::To<double_t>(value).FromJust();
+			// Integral numbers are stored as integers, matching what obs_data
+			//  would make of them when parsing JSON.
+			if (std::trunc(number) == number && std::fabs(number) < 9.2e18) {
+				writer.key(*name, size_t(name.length()), type::Int);
+				writer.value_int(int64_t(number));
+			} else {
+				writer.key(*name, size_t(name.length()), type::Double);
+				writer.value_double(number);
+			}
+		} else if (value->IsString()) {
+			v8::String::Utf8Value str(value);
+			writer.key(*name, size_t(name.length()), type::String);
+			writer.value_string(*str, size_t(str.length()));
+		} else if (value->IsArray()) {
+			v8::Local<v8::Array> array = value.As<v8::Array>();
+			writer.key(*name, size_t(name.length()), type::Array);
+
+			size_t   array_offset = writer.begin_count();
+			uint32_t array_count  = 0;
+			for (uint32_t el = 0; el < array->Length(); el++) {
+				v8::Local<v8::Value> element = Nan::Get(array, el).ToLocalChecked();
+				if (!element->IsObject() || element->IsArray() || element->IsFunction())
+					continue;
+				EncodeSettings(element.As<v8::Object>(), writer);
+				array_count++;
+			}
+			writer.end_count(array_offset, array_count);
+		} else if (value->IsObject() && !value->IsFunction()) {
+			writer.key(*name, size_t(name.length()), type::Object);
+			EncodeSettings(value.As<v8::Object>(), writer);
+		} else {
+			continue;
+		}
+		count++;
+	}
+
+	writer.end_count(offset, count);
+}
+
+static bool DecodeSettings(util::data_binary::reader& reader, v8::Local<v8::Object>& object)
+{
+	using util::data_binary::type;
+
+	uint32_t count = 0;
+	if (!reader.count(count))
+		return false;
+
+	object = Nan::New<v8::Object>();
+	for (uint32_t idx = 0; idx < count; idx++) {
+		const char* key    = nullptr;
+		size_t      length = 0;
+		type        t;
+		if (!reader.key(key, length, t))
+			return false;
+
+		v8::Local<v8::String> name = Nan::New<v8::String>(key, int(length)).ToLocalChecked();
+		switch (t) {
+		case type::Null:
+			Nan::Set(object, name, Nan::Null());
+			break;
+		case type::Bool: {
+			bool value;
+			if (!reader.value_bool(value))
+				return false;
+			Nan::Set(object, name, Nan::New<v8::Boolean>(value));
+			break;
+		}
+		case type::Int: {
+			int64_t value;
+			if (!reader.value_int(value))
+				return false;
+			Nan::Set(object, name, Nan::New<v8::Number>(double_t(value)));
+			break;
+		}
+		case type::Double: {
+			double   value;
+			if (!reader.value_double(value))
+				return false;
+			Nan::Set(object, name, Nan::New<v8::Number>(value));
+			break;
+		}
+		case type::String: {
+			const char* value      = nullptr;
+			size_t      value_size = 0;
+			if (!reader.value_string(value, value_size))
+				return false;
+			Nan::Set(object, name, Nan::New<v8::String>(value, int(value_size)).ToLocalChecked());
+			break;
+		}
+		case type::Object: {
+			v8::Local<v8::Object> child;
+			if (!DecodeSettings(reader, child))
+				return false;
+			Nan::Set(object, name, child);
+			break;
+		}
+		case type::Array: {
+			uint32_t array_count = 0;
+			if (!reader.count(array_count))
+				return false;
+
+			v8::Local<v8::Array> array = Nan::New<v8::Array>(int(array_count));
+			for (uint32_t el = 0; el < array_count; el++) {
+				v8::Local<v8::Object> child;
+				if (!DecodeSettings(reader, child))
+					return false;
+				Nan::Set(array, el, child);
+			}
+			Nan::Set(object, name, array);
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetTypeProperties(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	std::string type;
+	ASSERT_INFO_LENGTH(info, 1);
+	ASSERT_GET_VALUE(info[0], type);
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper("Source", "GetProperties", {ipc::value(type)});
+
+	if (!ValidateResponse(response))
+		return;
+
+	// Type properties aren't bound to a source, so they have no owner.
+	osn::property_map_t pmap = PropertyMapFromBuffer(response[1].value_bin);
+	if (pmap.empty()) {
+		info.GetReturnValue().Set(Nan::Null());
+		return;
+	}
+
+	info.GetReturnValue().Set(osn::Properties::Store(new osn::Properties(std::move(pmap))));
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetTypeDefaults(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	std::string type;
+	ASSERT_INFO_LENGTH(info, 1);
+	ASSERT_GET_VALUE(info[0], type);
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper("Source", "GetDefaults", {ipc::value(type)});
+
+	if (!ValidateResponse(response))
+		return;
+
+	util::data_binary::reader reader(response[1].value_bin.data(), response[1].value_bin.size());
+	v8::Local<v8::Object>     defaults;
+	if (!DecodeSettings(reader, defaults)) {
+		Nan::ThrowError("Malformed settings received from server.");
+		return;
+	}
+
+	info.GetReturnValue().Set(defaults);
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetTypeOutputFlags(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	std::string type;
+	ASSERT_INFO_LENGTH(info, 1);
+	ASSERT_GET_VALUE(info[0], type);
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper("Source", "GetOutputFlags", {ipc::value(type)});
+
+	if (!ValidateResponse(response))
+		return;
+
+	info.GetReturnValue().Set(response[1].value_union.ui32);
 }
 
 Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetSettings(Nan::NAN_METHOD_ARGS_TYPE info)
@@ -285,15 +575,51 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetSettings(Nan::NAN_METHOD_ARGS_TYPE
 		return;
 
 	std::vector<ipc::value> response =
-	    conn->call_synchronous_helper("Source", "GetSettings", {ipc::value(hndl->sourceId)});
+	    conn->call_synchronous_helper("Source", "GetSettingsBinary", {ipc::value(hndl->sourceId)});
+
+	if (!ValidateResponse(response))
+		return;
+
+	util::data_binary::reader reader(response[1].value_bin.data(), response[1].value_bin.size());
+	v8::Local<v8::Object>     settings;
+	if (!DecodeSettings(reader, settings)) {
+		Nan::ThrowError("Malformed settings received from server.");
+		return;
+	}
+
+	info.GetReturnValue().Set(settings);
+	return;
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetSettingsSince(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	double_t since;
+	ASSERT_INFO_LENGTH(info, 1);
+	ASSERT_GET_VALUE(info[0], since);
+
+	osn::ISource* hndl = nullptr;
+	if (!utilv8::SafeUnwrap<osn::ISource>(info, hndl)) {
+		return;
+	}
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper(
+	    "Source", "GetSettings", {ipc::value(hndl->sourceId), ipc::value(uint64_t(since))});
 
 	if (!ValidateResponse(response))
 		return;
 
 	v8::Local<v8::String> jsondata = Nan::New<v8::String>(response[1].value_str).ToLocalChecked();
 	v8::Local<v8::Value>  json     = v8::JSON::Parse(info.GetIsolate()->GetCurrentContext(), jsondata).ToLocalChecked();
-	info.GetReturnValue().Set(json);
-	return;
+
+	v8::Local<v8::Object> result = Nan::New<v8::Object>();
+	utilv8::SetObjectField(result, "settings", json);
+	utilv8::SetObjectField(result, "version", double_t(response[2].value_union.ui64));
+	utilv8::SetObjectField(result, "full", !!response[3].value_union.i32);
+	info.GetReturnValue().Set(result);
 }
 
 Nan::NAN_METHOD_RETURN_TYPE osn::ISource::Update(Nan::NAN_METHOD_ARGS_TYPE info)
@@ -307,18 +633,16 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::Update(Nan::NAN_METHOD_ARGS_TYPE info)
 		return;
 	}
 
-	// Turn json into string
-	v8::Local<v8::String> jsondata = v8::JSON::Stringify(info.GetIsolate()->GetCurrentContext(), json).ToLocalChecked();
-	v8::String::Utf8Value jsondatautf8(jsondata);
+	std::vector<char>         data;
+	util::data_binary::writer writer(data);
+	EncodeSettings(json, writer);
 
 	auto conn = GetConnection();
 	if (!conn)
 		return;
 
-	std::vector<ipc::value> response = conn->call_synchronous_helper(
-	    "Source",
-	    "Update",
-	    {ipc::value(hndl->sourceId), ipc::value(std::string(*jsondatautf8, (size_t)jsondatautf8.length()))});
+	std::vector<ipc::value> response =
+	    conn->call_synchronous_helper("Source", "Update", {ipc::value(hndl->sourceId), ipc::value(data)});
 
 	if (!ValidateResponse(response))
 		return;
@@ -551,17 +875,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::ISource::SetMuted(Nan::NAN_METHOD_ARGS_TYPE inf
 		return;
 	}
 
-	auto conn = GetConnection();
-	if (!conn)
-		return;
-
-	std::vector<ipc::value> response =
-	    conn->call_synchronous_helper("Source", "SetMuted", {ipc::value(is->sourceId), ipc::value(muted)});
-
-	if (!ValidateResponse(response))
-		return;
-
-	info.GetReturnValue().Set((bool)response[1].value_union.i32 == muted);
+	Controller::GetInstance().call_one_way("Source", "SetMuted", {ipc::value(is->sourceId), ipc::value(muted)});
 }
 
 Nan::NAN_METHOD_RETURN_TYPE osn::ISource::GetEnabled(Nan::NAN_METHOD_ARGS_TYPE info)
@@ -27,6 +27,21 @@
 #include "shared.hpp"
 #include "utility.hpp"
 
+static v8::Local<v8::Value> InitAPIFromResponse(std::vector<ipc::value>& response, v8::Local<v8::Object>)
+{
+	// The API init method will return a response error + graphical error
+	// If there is a problem with the IPC the number of responses here will be zero so we must validate the
+	// response.
+	// If the method call was sucessfull we will have 2 arguments, also there is no need to validate the
+	// response
+	if (response.size() < 2) {
+		if (!ValidateResponse(response)) {
+			return v8::Local<v8::Value>();
+		}
+	}
+	return v8::Number::New(v8::Isolate::GetCurrent(), response[1].value_union.i32);
+}
+
 void api::OBS_API_initAPI(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
 	std::string path;
@@ -42,17 +57,23 @@ void api::OBS_API_initAPI(const v8::FunctionCallbackInfo<v8::Value>& args)
 	std::vector<ipc::value> response =
 	    conn->call_synchronous_helper("API", "OBS_API_initAPI", {ipc::value(path), ipc::value(language)});
 
-	// The API init method will return a response error + graphical error
-	// If there is a problem with the IPC the number of responses here will be zero so we must validate the
-	// response.
-	// If the method call was sucessfull we will have 2 arguments, also there is no need to validate the
-	// response
-	if (response.size() < 2) {
-		if (!ValidateResponse(response)) {
-			return;
-		}
-	}
-	args.GetReturnValue().Set(v8::Number::New(args.GetIsolate(), response[1].value_union.i32));
+	v8::Local<v8::Value> rval = InitAPIFromResponse(response, v8::Local<v8::Object>());
+	if (rval.IsEmpty())
+		return;
+
+	args.GetReturnValue().Set(rval);
+}
+
+void api::OBS_API_initAPIAsync(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	std::string path;
+	std::string language;
+
+	ASSERT_GET_VALUE(args[0], language);
+	ASSERT_GET_VALUE(args[1], path);
+
+	args.GetReturnValue().Set(utility::CallAsync(
+	    "API", "OBS_API_initAPI", {ipc::value(path), ipc::value(language)}, InitAPIFromResponse));
 }
 
 void api::OBS_API_destroyOBS_API(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -198,6 +219,7 @@ INITIALIZER(nodeobs_api)
 {
 	initializerFunctions.push([](v8::Local<v8::Object> exports) {
 		NODE_SET_METHOD(exports, "OBS_API_initAPI", api::OBS_API_initAPI);
+		NODE_SET_METHOD(exports, "OBS_API_initAPIAsync", api::OBS_API_initAPIAsync);
 		NODE_SET_METHOD(exports, "OBS_API_destroyOBS_API", api::OBS_API_destroyOBS_API);
 		NODE_SET_METHOD(exports, "OBS_API_getPerformanceStatistics", api::OBS_API_getPerformanceStatistics);
 		NODE_SET_METHOD(exports, "SetWorkingDirectory", api::SetWorkingDirectory);
@@ -23,6 +23,7 @@
 namespace api
 {
 	static void OBS_API_initAPI(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void OBS_API_initAPIAsync(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void OBS_API_destroyOBS_API(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void OBS_API_getPerformanceStatistics(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetWorkingDirectory(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -131,20 +131,10 @@ std::vector<settings::SubCategory>
 	return category;
 }
 
-void settings::OBS_settings_getSettings(const v8::FunctionCallbackInfo<v8::Value>& args)
+static v8::Local<v8::Value> SettingsFromResponse(std::vector<ipc::value>& response, v8::Local<v8::Object>)
 {
-	std::string category;
-	ASSERT_GET_VALUE(args[0], category);
-
-	auto conn = GetConnection();
-	if (!conn)
-		return;
-
-	std::vector<ipc::value> response =
-	    conn->call_synchronous_helper("Settings", "OBS_settings_getSettings", {ipc::value(category)});
-
 	if (!ValidateResponse(response))
-		return;
+		return v8::Local<v8::Value>();
 
 	v8::Isolate*         isolate = v8::Isolate::GetCurrent();
 	v8::Local<v8::Array> rval    = v8::Array::New(isolate);
@@ -344,8 +334,35 @@ void settings::OBS_settings_getSettings(const v8::FunctionCallbackInfo<v8::Value
 		rval->Set(i, subCategory);
 		rval->Set(v8::String::NewFromUtf8(isolate, "type"), v8::Integer::New(isolate, response[4].value_union.ui32));
 	}
+	return rval;
+}
+
+void settings::OBS_settings_getSettings(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	std::string category;
+	ASSERT_GET_VALUE(args[0], category);
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response =
+	    conn->call_synchronous_helper("Settings", "OBS_settings_getSettings", {ipc::value(category)});
+
+	v8::Local<v8::Value> rval = SettingsFromResponse(response, v8::Local<v8::Object>());
+	if (rval.IsEmpty())
+		return;
+
 	args.GetReturnValue().Set(rval);
-	return;
+}
+
+void settings::OBS_settings_getSettingsAsync(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+	std::string category;
+	ASSERT_GET_VALUE(args[0], category);
+
+	args.GetReturnValue().Set(
+	    utility::CallAsync("Settings", "OBS_settings_getSettings", {ipc::value(category)}, SettingsFromResponse));
 }
 
 std::vector<char> deserializeCategory(uint32_t* subCategoriesCount, uint32_t* sizeStruct, v8::Local<v8::Array> settings)
@@ -508,6 +525,7 @@ INITIALIZER(nodeobs_settings)
 {
 	initializerFunctions.push([](v8::Local<v8::Object> exports) {
 		NODE_SET_METHOD(exports, "OBS_settings_getSettings", settings::OBS_settings_getSettings);
+		NODE_SET_METHOD(exports, "OBS_settings_getSettingsAsync", settings::OBS_settings_getSettingsAsync);
 		NODE_SET_METHOD(exports, "OBS_settings_saveSettings", settings::OBS_settings_saveSettings);
 		NODE_SET_METHOD(exports, "OBS_settings_getListCategories", settings::OBS_settings_getListCategories);
 	});
@@ -135,6 +135,7 @@ namespace settings
 	};
 
 	static void OBS_settings_getSettings(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void OBS_settings_getSettingsAsync(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void OBS_settings_saveSettings(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void OBS_settings_getListCategories(const v8::FunctionCallbackInfo<v8::Value>& args);
 } // namespace settings
@@ -18,6 +18,7 @@
 
 #include "properties.hpp"
 #include "isource.hpp"
+#include "obs-property.hpp"
 #include "utility-v8.hpp"
 
 Nan::Persistent<v8::FunctionTemplate> osn::Properties::prototype     = Nan::Persistent<v8::FunctionTemplate>();
@@ -39,6 +40,12 @@ osn::Properties::Properties(property_map_t container, v8::Local<v8::Object> owne
 	properties = std::make_shared<property_map_t>(std::move(container));
 }
 
+osn::Properties::Properties(std::shared_ptr<property_map_t> container, v8::Local<v8::Object> owner)
+    : owner(v8::Isolate::GetCurrent(), owner)
+{
+	properties = container;
+}
+
 osn::Properties::~Properties()
 {
 	properties = nullptr; // Technically not needed, just here for testing.
@@ -168,6 +175,7 @@ void osn::PropertyObject::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target
 	utilv8::SetTemplateAccessorProperty(objtemplate, "enabled", IsEnabled);
 	utilv8::SetTemplateAccessorProperty(objtemplate, "visible", IsVisible);
 	utilv8::SetTemplateAccessorProperty(objtemplate, "details", GetDetails);
+	utilv8::SetTemplateField(objtemplate, "getItems", GetItems);
 
 	utilv8::SetTemplateAccessorProperty(objtemplate, "type", GetType);
 
@@ -429,6 +437,32 @@ Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::GetType(Nan::NAN_METHOD_ARGS_TY
 	return;
 }
 
+static v8::Local<v8::Array>
+    ListItemsToArray(osn::ListProperty::Format format, std::list<osn::ListProperty::Item> const& items)
+{
+	v8::Local<v8::Array> itemsobj = Nan::New<v8::Array>();
+	size_t               idx      = 0;
+	for (auto& itm : items) {
+		v8::Local<v8::Object> iobj = Nan::New<v8::Object>();
+		utilv8::SetObjectField(iobj, "name", itm.name);
+		utilv8::SetObjectField(iobj, "enabled", !itm.disabled);
+		switch (format) {
+		case osn::ListProperty::Format::INT:
+			utilv8::SetObjectField(iobj, "value", itm.value_int);
+			break;
+		case osn::ListProperty::Format::FLOAT:
+			utilv8::SetObjectField(iobj, "value", itm.value_float);
+			break;
+		case osn::ListProperty::Format::STRING:
+			utilv8::SetObjectField(iobj, "value", itm.value_str);
+			break;
+		}
+
+		utilv8::SetObjectField(itemsobj, (uint32_t)idx++, iobj);
+	}
+	return itemsobj;
+}
+
 Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::GetDetails(Nan::NAN_METHOD_ARGS_TYPE info)
 {
 	osn::PropertyObject* self;
@@ -490,27 +524,8 @@ Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::GetDetails(Nan::NAN_METHOD_ARGS
 		utilv8::SetObjectField(object, "type", (uint32_t)prop->field_type);
 		utilv8::SetObjectField(object, "format", (uint32_t)prop->item_format);
 
-		v8::Local<v8::Array> itemsobj = Nan::New<v8::Array>();
-		size_t               idx      = 0;
-		for (auto itm : prop->items) {
-			v8::Local<v8::Object> iobj = Nan::New<v8::Object>();
-			utilv8::SetObjectField(iobj, "name", itm.name);
-			utilv8::SetObjectField(iobj, "enabled", !itm.disabled);
-			switch (prop->item_format) {
-			case ListProperty::Format::INT:
-				utilv8::SetObjectField(iobj, "value", itm.value_int);
-				break;
-			case ListProperty::Format::FLOAT:
-				utilv8::SetObjectField(iobj, "value", itm.value_float);
-				break;
-			case ListProperty::Format::STRING:
-				utilv8::SetObjectField(iobj, "value", itm.value_str);
-				break;
-			}
-
-			utilv8::SetObjectField(itemsobj, (uint32_t)idx++, iobj);
-		}
-		utilv8::SetObjectField(object, "items", itemsobj);
+		utilv8::SetObjectField(object, "items", ListItemsToArray(prop->item_format, prop->items));
+		utilv8::SetObjectField(object, "itemCount", (uint32_t)prop->item_count);
 
 		break;
 	}
@@ -563,6 +578,82 @@ Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::GetDetails(Nan::NAN_METHOD_ARGS
 	return;
 }
 
+Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::GetItems(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	uint32_t offset, count;
+
+	ASSERT_INFO_LENGTH(info, 2);
+	ASSERT_GET_VALUE(info[0], offset);
+	ASSERT_GET_VALUE(info[1], count);
+	/// Self
+	osn::PropertyObject* self;
+	if (!Retrieve(info.This(), self)) {
+		return;
+	}
+	/// Parent
+	osn::Properties* parent;
+	if (!osn::Properties::Retrieve(self->parent.Get(info.GetIsolate()), parent)) {
+		Nan::ThrowReferenceError("Parent invalidated while child is still alive.");
+		return;
+	}
+	/// Parent Source (if one exists).
+	osn::ISource* parent_source;
+	if (parent->GetOwner().IsEmpty()) {
+		Nan::ThrowError("Properties of a source type are not bound to a source.");
+		return;
+	}
+	if (!osn::ISource::Retrieve(parent->GetOwner(), parent_source)) {
+		return;
+	}
+
+	auto iter = parent->GetProperties()->find(self->index);
+	if ((iter == parent->GetProperties()->end()) || (iter->second->type != osn::Property::Type::LIST)) {
+		info.GetReturnValue().Set(Nan::Null());
+		return;
+	}
+
+	// Call
+	auto conn = GetConnection();
+	if (!conn) {
+		return;
+	}
+	auto rval = conn->call_synchronous_helper(
+	    "Source",
+	    "GetListItems",
+	    {ipc::value(parent_source->sourceId), ipc::value(iter->second->name), ipc::value(offset), ipc::value(count)});
+
+	if (!ValidateResponse(rval)) {
+		return;
+	}
+
+	auto raw_property = std::dynamic_pointer_cast<obs::ListProperty>(obs::Property::deserialize(rval[1].value_bin));
+	if (!raw_property) {
+		info.GetReturnValue().Set(Nan::Null());
+		return;
+	}
+
+	std::list<osn::ListProperty::Item> items;
+	for (auto& item : raw_property->items) {
+		osn::ListProperty::Item item2;
+		item2.name     = item.name;
+		item2.disabled = !item.enabled;
+		switch (raw_property->format) {
+		case obs::ListProperty::Format::Integer:
+			item2.value_int = item.value_int;
+			break;
+		case obs::ListProperty::Format::Float:
+			item2.value_float = item.value_float;
+			break;
+		case obs::ListProperty::Format::String:
+			item2.value_str = item.value_string;
+			break;
+		}
+		items.push_back(std::move(item2));
+	}
+
+	info.GetReturnValue().Set(ListItemsToArray(osn::ListProperty::Format(raw_property->format), items));
+}
+
 Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::Modified(Nan::NAN_METHOD_ARGS_TYPE info)
 {
 	v8::Local<v8::Object> settings;
@@ -584,6 +675,10 @@ Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::Modified(Nan::NAN_METHOD_ARGS_T
 	}
 	/// Parent Source (if one exists).
 	osn::ISource* parent_source;
+	if (parent->GetOwner().IsEmpty()) {
+		Nan::ThrowError("Properties of a source type are not bound to a source.");
+		return;
+	}
 	if (!osn::ISource::Retrieve(parent->GetOwner(), parent_source)) {
 		return;
 	}
@@ -641,6 +736,10 @@ Nan::NAN_METHOD_RETURN_TYPE osn::PropertyObject::ButtonClicked(Nan::NAN_METHOD_A
 	}
 	/// Parent Source (if one exists).
 	osn::ISource* parent_source;
+	if (parent->GetOwner().IsEmpty()) {
+		Nan::ThrowError("Properties of a source type are not bound to a source.");
+		return;
+	}
 	if (!osn::ISource::Retrieve(parent->GetOwner(), parent_source)) {
 		return;
 	}
@@ -136,6 +136,7 @@ namespace osn
 		Type            field_type;
 		Format          item_format;
 		std::list<Item> items;
+		size_t          item_count = 0;
 	};
 
 	// Contrary to the name, not compatible with the ListProperty. Actually more comparable to PathProperty.
@@ -188,6 +189,7 @@ namespace osn
 		Properties();
 		Properties(property_map_t container);
 		Properties(property_map_t container, v8::Local<v8::Object> owner);
+		Properties(std::shared_ptr<property_map_t> container, v8::Local<v8::Object> owner);
 		~Properties();
 
 		std::shared_ptr<property_map_t> GetProperties();
@@ -234,6 +236,7 @@ namespace osn
 		static Nan::NAN_METHOD_RETURN_TYPE GetType(Nan::NAN_METHOD_ARGS_TYPE info);
 
 		static Nan::NAN_METHOD_RETURN_TYPE GetDetails(Nan::NAN_METHOD_ARGS_TYPE info);
+		static Nan::NAN_METHOD_RETURN_TYPE GetItems(Nan::NAN_METHOD_ARGS_TYPE info);
 
 		static Nan::NAN_METHOD_RETURN_TYPE Modified(Nan::NAN_METHOD_ARGS_TYPE info);
 		static Nan::NAN_METHOD_RETURN_TYPE ButtonClicked(Nan::NAN_METHOD_ARGS_TYPE info);
@@ -26,6 +26,7 @@
 #include "ipc-value.hpp"
 #include "sceneitem.hpp"
 #include "shared.hpp"
+#include "util-scene-snapshot.hpp"
 #include "utility.hpp"
 
 osn::Scene::Scene(uint64_t id)
@@ -60,6 +61,7 @@ void osn::Scene::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 	utilv8::SetTemplateField(objtemplate, "getItemAtIdx", GetItemAtIndex);
 	utilv8::SetTemplateField(objtemplate, "getItems", GetItems);
 	utilv8::SetTemplateField(objtemplate, "getItemsInRange", GetItemsInRange);
+	utilv8::SetTemplateField(objtemplate, "getSnapshot", GetSnapshot);
 	utilv8::SetTemplateField(objtemplate, "connect", Connect);
 	utilv8::SetTemplateField(objtemplate, "disconnect", Disconnect);
 
@@ -460,6 +462,83 @@ simple.
 //	item_signal_desc
 //};
 
+static v8::Local<v8::Object> Vec2ToObject(float x, float y)
+{
+	auto obj = Nan::New<v8::Object>();
+	utilv8::SetObjectField(obj, "x", x);
+	utilv8::SetObjectField(obj, "y", y);
+	return obj;
+}
+
+Nan::NAN_METHOD_RETURN_TYPE osn::Scene::GetSnapshot(Nan::NAN_METHOD_ARGS_TYPE info)
+{
+	osn::Scene* scene = nullptr;
+	if (!utilv8::RetrieveDynamicCast<osn::ISource, osn::Scene>(info.This(), scene)) {
+		return;
+	}
+
+	double_t since = 0;
+	if (info.Length() > 0) {
+		ASSERT_GET_VALUE(info[0], since);
+	}
+
+	auto conn = GetConnection();
+	if (!conn)
+		return;
+
+	std::vector<ipc::value> response = conn->call_synchronous_helper(
+	    "Scene", "GetSnapshot", std::vector<ipc::value>{ipc::value(scene->sourceId), ipc::value(uint64_t(since))});
+
+	if (!ValidateResponse(response))
+		return;
+
+	// Only the version comes back when nothing changed since the given one.
+	v8::Local<v8::Object> snapshot = Nan::New<v8::Object>();
+	utilv8::SetObjectField(snapshot, "version", double_t(response[1].value_union.ui64));
+	utilv8::SetObjectField(snapshot, "changed", response.size() > 2);
+	if (response.size() == 2) {
+		info.GetReturnValue().Set(snapshot);
+		return;
+	}
+
+	std::vector<util::scene_snapshot::item_state> states;
+	if (!util::scene_snapshot::unpack(response[2].value_bin, states)) {
+		Nan::ThrowError("Malformed scene snapshot received from server.");
+		return;
+	}
+
+	auto items = Nan::New<v8::Array>(int(states.size()));
+	for (size_t idx = 0; idx < states.size(); idx++) {
+		const util::scene_snapshot::item_state& state = states[idx];
+
+		auto crop = Nan::New<v8::Object>();
+		utilv8::SetObjectField(crop, "left", state.crop[0]);
+		utilv8::SetObjectField(crop, "top", state.crop[1]);
+		utilv8::SetObjectField(crop, "right", state.crop[2]);
+		utilv8::SetObjectField(crop, "bottom", state.crop[3]);
+
+		auto obj = Nan::New<v8::Object>();
+		utilv8::SetObjectField(obj, "item", osn::SceneItem::Store(new osn::SceneItem(state.item)));
+		utilv8::SetObjectField(obj, "source", osn::Input::Store(new osn::Input(state.source)));
+		utilv8::SetObjectField(obj, "id", double_t(state.id));
+		utilv8::SetObjectField(obj, "position", Vec2ToObject(state.position[0], state.position[1]));
+		utilv8::SetObjectField(obj, "rotation", state.rotation);
+		utilv8::SetObjectField(obj, "scale", Vec2ToObject(state.scale[0], state.scale[1]));
+		utilv8::SetObjectField(obj, "alignment", state.alignment);
+		utilv8::SetObjectField(obj, "bounds", Vec2ToObject(state.bounds[0], state.bounds[1]));
+		utilv8::SetObjectField(obj, "boundsType", state.bounds_type);
+		utilv8::SetObjectField(obj, "boundsAlignment", state.bounds_alignment);
+		utilv8::SetObjectField(obj, "crop", crop);
+		utilv8::SetObjectField(obj, "scaleFilter", state.scale_filter);
+		utilv8::SetObjectField(obj, "visible", (state.flags & util::scene_snapshot::flag_visible) != 0);
+		utilv8::SetObjectField(obj, "selected", (state.flags & util::scene_snapshot::flag_selected) != 0);
+		Nan::Set(items, uint32_t(idx), obj);
+	}
+	utilv8::SetObjectField(snapshot, "items", items);
+
+	info.GetReturnValue().Set(snapshot);
+}
+
 Nan::NAN_METHOD_RETURN_TYPE osn::Scene::Connect(Nan::NAN_METHOD_ARGS_TYPE info)
 {
 	//obs::weak<obs::scene> &scene = Scene::Object::GetHandle(info.Holder());
@@ -42,6 +42,9 @@ void osn::Transition::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 
 	// Class Template
 	utilv8::SetTemplateField(fnctemplate, "types", Types);
+	utilv8::SetTemplateField(fnctemplate, "getTypeProperties", osn::ISource::GetTypeProperties);
+	utilv8::SetTemplateField(fnctemplate, "getTypeDefaults", osn::ISource::GetTypeDefaults);
+	utilv8::SetTemplateField(fnctemplate, "getTypeOutputFlags", osn::ISource::GetTypeOutputFlags);
 	utilv8::SetTemplateField(fnctemplate, "create", Create);
 	utilv8::SetTemplateField(fnctemplate, "createPrivate", CreatePrivate);
 	utilv8::SetTemplateField(fnctemplate, "fromName", FromName);
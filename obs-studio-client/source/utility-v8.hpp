@@ -439,6 +439,32 @@ namespace utilv8
 		return v8::Float64Array::New(rv, 0, v.size());
 	}
 
+	// Creates a Float32Array from packed floats without boxing each element.
+	inline v8::Local<v8::Float32Array> ToFloat32Array(const float* data, size_t count)
+	{
+		auto rv = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), count * sizeof(float_t));
+		if (count > 0)
+			memcpy(rv->GetContents().Data(), data, count * sizeof(float_t));
+		return v8::Float32Array::New(rv, 0, count);
+	}
+
+	inline v8::Local<v8::Float32Array> ToFloat32Array(const std::vector<float_t>& v)
+	{
+		return ToFloat32Array(v.data(), v.size());
+	}
+
+	// Creates a typed array (e.g. v8::Uint32Array holding uint32_t) from an
+	//  ipc::type::Binary value holding packed elements.
+	template<typename A, typename T>
+	inline v8::Local<v8::Value> ToTypedArray(const std::vector<char>& buf)
+	{
+		size_t count = buf.size() / sizeof(T);
+		auto   rv    = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), count * sizeof(T));
+		if (count > 0)
+			memcpy(rv->GetContents().Data(), buf.data(), count * sizeof(T));
+		return A::New(rv, 0, count);
+	}
+
 	template<typename T>
 	inline void SetObjectField(v8::Local<v8::Object> object, const char* field, T value)
 	{
@@ -89,6 +89,98 @@ void Utility::SetThreadName(const char* threadName)
 
 static thread_local std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
 
+class AsyncIPCCall : public Nan::AsyncWorker
+{
+	std::string                            m_cname;
+	std::string                            m_fname;
+	std::vector<ipc::value>                m_args;
+	std::vector<ipc::value>                m_response;
+	utility::async_converter_t             m_converter;
+	Nan::Persistent<v8::Promise::Resolver> m_resolver;
+
+	public:
+	AsyncIPCCall(
+	    const std::string&               cname,
+	    const std::string&               fname,
+	    std::vector<ipc::value>          args,
+	    utility::async_converter_t       converter,
+	    v8::Local<v8::Promise::Resolver> resolver,
+	    v8::Local<v8::Object>            self)
+	    : Nan::AsyncWorker(nullptr), m_cname(cname), m_fname(fname), m_args(std::move(args)),
+	      m_converter(converter)
+	{
+		m_resolver.Reset(resolver);
+		if (!self.IsEmpty())
+			SaveToPersistent("self", self);
+	}
+
+	~AsyncIPCCall()
+	{
+		m_resolver.Reset();
+	}
+
+	void Execute() override
+	{
+		// Runs on a worker thread, so waiting for earlier one-way calls doesn't block JavaScript.
+		Controller::GetInstance().flush_one_way();
+
+		auto conn = Controller::GetInstance().GetConnection();
+		if (!conn) {
+			SetErrorMessage("Failed to obtain IPC connection.");
+			return;
+		}
+
+		try {
+			m_response = conn->call_synchronous_helper(m_cname, m_fname, m_args);
+		} catch (const std::exception& e) {
+			SetErrorMessage(e.what());
+		}
+	}
+
+	void HandleOKCallback() override
+	{
+		Nan::HandleScope                 scope;
+		v8::Local<v8::Promise::Resolver> resolver = Nan::New(m_resolver);
+		v8::Local<v8::Object>            self;
+
+		v8::Local<v8::Value> self_value = GetFromPersistent("self");
+		if (!self_value.IsEmpty() && self_value->IsObject())
+			self = self_value.As<v8::Object>();
+
+		Nan::TryCatch        try_catch;
+		v8::Local<v8::Value> result = m_converter(m_response, self);
+		if (try_catch.HasCaught()) {
+			resolver->Reject(Nan::GetCurrentContext(), try_catch.Exception());
+		} else if (result.IsEmpty()) {
+			resolver->Reject(Nan::GetCurrentContext(), Nan::Error("Failed to make IPC call, verify IPC status."));
+		} else {
+			resolver->Resolve(Nan::GetCurrentContext(), result);
+		}
+		v8::Isolate::GetCurrent()->RunMicrotasks();
+	}
+
+	void HandleErrorCallback() override
+	{
+		Nan::HandleScope                 scope;
+		v8::Local<v8::Promise::Resolver> resolver = Nan::New(m_resolver);
+
+		resolver->Reject(Nan::GetCurrentContext(), Nan::Error(ErrorMessage()));
+		v8::Isolate::GetCurrent()->RunMicrotasks();
+	}
+};
+
+v8::Local<v8::Promise> utility::CallAsync(
+    const std::string&      cname,
+    const std::string&      fname,
+    std::vector<ipc::value> args,
+    async_converter_t       converter,
+    v8::Local<v8::Object>   self)
+{
+	v8::Local<v8::Promise::Resolver> resolver = v8::Promise::Resolver::New(Nan::GetCurrentContext()).ToLocalChecked();
+	Nan::AsyncQueueWorker(new AsyncIPCCall(cname, fname, std::move(args), converter, resolver, self));
+	return resolver->GetPromise();
+}
+
 std::string from_utf16_wide_to_utf8(const wchar_t* from, size_t length)
 {
 	const wchar_t* from_end;
@@ -17,6 +17,7 @@
 ******************************************************************************/
 
 #pragma once
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -122,6 +123,9 @@ static bool ValidateResponse(std::vector<ipc::value>& response)
 
 static FORCE_INLINE std::shared_ptr<ipc::client> GetConnection()
 {
+	// Synchronous calls must observe every one-way call queued before them.
+	Controller::GetInstance().flush_one_way();
+
 	auto conn = Controller::GetInstance().GetConnection();
 	if (!conn) {
 		Nan::ThrowError("Failed to obtain IPC connection.");
@@ -130,6 +134,17 @@ static FORCE_INLINE std::shared_ptr<ipc::client> GetConnection()
 	return conn;
 }
 
+static FORCE_INLINE std::shared_ptr<ipc::client> GetConcurrentConnection()
+{
+	// Concurrent reads do not depend on earlier one-way calls, so no flush here.
+	auto conn = Controller::GetInstance().GetConcurrentConnection();
+	if (!conn) {
+		Nan::ThrowError("Failed to obtain IPC connection.");
+		exit(1);
+	}
+	return conn;
+}
+
 namespace utility
 {
 	template<typename T>
@@ -169,6 +184,22 @@ namespace utility
 	AUTO_TYPEOF_NAME(v8::Local<v8::Object>, "object");
 	AUTO_TYPEOF_NAME(v8::Local<v8::Function>, "function");
 
+	// Turns a successful response into the value a Promise resolves with. It
+	//  runs on the main loop, may throw a v8 exception (for example through
+	//  ValidateResponse()) and returns an empty handle on failure. 'self' is
+	//  the object the call was made on, if any.
+	typedef std::function<v8::Local<v8::Value>(std::vector<ipc::value>& response, v8::Local<v8::Object> self)>
+	    async_converter_t;
+
+	// Issues an ipc call from the libuv thread pool and settles the returned
+	//  Promise on the main loop, so the calling thread is never blocked.
+	v8::Local<v8::Promise> CallAsync(
+	    const std::string&      cname,
+	    const std::string&      fname,
+	    std::vector<ipc::value> args,
+	    async_converter_t       converter,
+	    v8::Local<v8::Object>   self = v8::Local<v8::Object>());
+
 	// This is from enc-amf
 #if (defined _WIN32) || (defined _WIN64)
 	void SetThreadName(uint32_t dwThreadID, const char* threadName);
@@ -35,7 +35,7 @@ void osn::Video::Register(Nan::ADDON_REGISTER_FUNCTION_ARGS_TYPE target)
 
 Nan::NAN_METHOD_RETURN_TYPE osn::Video::skippedFrames(Nan::NAN_METHOD_ARGS_TYPE info)
 {
-	auto conn = GetConnection();
+	auto conn = GetConcurrentConnection();
 	if (!conn)
 		return;
 
@@ -50,7 +50,7 @@ Nan::NAN_METHOD_RETURN_TYPE osn::Video::skippedFrames(Nan::NAN_METHOD_ARGS_TYPE
 
 Nan::NAN_METHOD_RETURN_TYPE osn::Video::encodedFrames(Nan::NAN_METHOD_ARGS_TYPE info)
 {
-	auto conn = GetConnection();
+	auto conn = GetConcurrentConnection();
 	if (!conn)
 		return;
 
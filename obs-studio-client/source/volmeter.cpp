@@ -17,6 +17,7 @@
 ******************************************************************************/
 
 #include "volmeter.hpp"
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <vector>
@@ -27,6 +28,15 @@
 #include "utility-v8.hpp"
 #include "utility.hpp"
 
+std::thread                        osn::VolMeter::s_worker;
+std::atomic<bool>                  osn::VolMeter::s_worker_stop(true);
+std::atomic<bool>                  osn::VolMeter::s_resync(true);
+util::shared_memory                osn::VolMeter::s_shared_levels;
+bool                               osn::VolMeter::s_shared_checked = false;
+bool                               osn::VolMeter::s_shared_valid   = false;
+std::mutex                         osn::VolMeter::s_worker_lock;
+std::map<uint64_t, osn::VolMeter*> osn::VolMeter::s_subscribers;
+
 osn::VolMeter::VolMeter(uint64_t p_uid)
 {
 	m_uid = p_uid;
@@ -68,99 +78,194 @@ void osn::VolMeter::stop_async_runner()
 
 void osn::VolMeter::callback_handler(void* data, std::shared_ptr<osn::VolMeterData> item)
 {
-	// utilv8::ToValue on a std::vector<> creates a v8::Local<v8::Array> automatically.
-	v8::Local<v8::Value> args[] = {
-	    utilv8::ToValue(item->magnitude), utilv8::ToValue(item->peak), utilv8::ToValue(item->input_peak)};
+	v8::Local<v8::Value> args[] = {utilv8::ToFloat32Array(item->magnitude),
+	                               utilv8::ToFloat32Array(item->peak),
+	                               utilv8::ToFloat32Array(item->input_peak)};
 
 	Nan::Call(m_callback_function, 3, args);
 }
 
 void osn::VolMeter::start_worker()
 {
-	if (!m_worker_stop)
+	std::unique_lock<std::mutex> ul(s_worker_lock);
+	s_subscribers[m_uid] = this;
+	s_resync = true;
+
+	if (!s_worker_stop)
 		return;
 
-	// Launch worker thread.
-	m_worker_stop = false;
-	m_worker      = std::thread(std::bind(&osn::VolMeter::worker, this));
+	// Launch the shared worker thread.
+	s_shared_checked = false;
+	s_worker_stop    = false;
+	s_worker      = std::thread(&osn::VolMeter::worker);
 }
 
 void osn::VolMeter::stop_worker()
 {
-	if (m_worker_stop != false)
+	std::unique_lock<std::mutex> ul(s_worker_lock);
+	s_subscribers.erase(m_uid);
+
+	if (!s_subscribers.empty() || s_worker_stop)
 		return;
 
-	// Stop worker thread.
-	m_worker_stop = true;
-	if (m_worker.joinable()) {
-		m_worker.join();
+	// Stop worker thread once the last meter unsubscribed.
+	s_worker_stop = true;
+	ul.unlock();
+	if (s_worker.joinable()) {
+		s_worker.join();
 	}
 }
 
-void osn::VolMeter::worker()
+static bool map_shared_levels(std::shared_ptr<ipc::client> conn, util::shared_memory& shm)
 {
-	size_t totalSleepMS = 0;
+	std::vector<ipc::value> response = conn->call_synchronous_helper("VolMeter", "GetSharedLevels", {});
+	if ((response.size() < 3) || ((ErrorCode)response[0].value_union.ui64 != ErrorCode::Ok)) {
+		return false;
+	}
+
+	if (!shm.open(response[1].value_str, obs::VolMeterSharedSize())) {
+		return false;
+	}
+
+	auto header = reinterpret_cast<obs::VolMeterSharedHeader*>(shm.data());
+	if ((header->magic != obs::VolMeterSharedMagic) || (header->version != obs::VolMeterSharedVersion)
+	    || (header->slot_count != obs::VolMeterSharedSlotCount)
+	    || (header->slot_size != sizeof(obs::VolMeterSharedSlot))) {
+		shm.close();
+		return false;
+	}
 
-	while (!m_worker_stop) {
-		auto tp_start = std::chrono::high_resolution_clock::now();
+	return true;
+}
+
+void osn::VolMeter::queue_levels(obs::VolMeterLevels& levels)
+{
+	std::shared_ptr<osn::VolMeterData> data = std::make_shared<osn::VolMeterData>();
+	data->magnitude  = std::move(levels.magnitude);
+	data->peak       = std::move(levels.peak);
+	data->input_peak = std::move(levels.input_peak);
+	data->param      = this;
+
+	std::unique_lock<std::mutex> ul(m_worker_lock);
+	if (m_async_callback)
+		m_async_callback->queue(std::move(data));
+}
+
+void osn::VolMeter::worker()
+{
+	while (!s_worker_stop) {
+		auto     tp_start       = std::chrono::high_resolution_clock::now();
+		uint32_t sleep_interval = 33;
+		bool     need_ipc       = true;
+
+		{
+			std::unique_lock<std::mutex> ul(s_worker_lock);
+			if (!s_subscribers.empty()) {
+				sleep_interval = UINT32_MAX;
+				for (auto& kv : s_subscribers) {
+					sleep_interval = std::min(sleep_interval, kv.second->m_sleep_interval);
+				}
+			}
+		}
 
 		// Validate Connection
-		auto conn = Controller::GetInstance().GetConnection();
+		auto conn = Controller::GetInstance().GetConcurrentConnection();
 		if (!conn) {
 			goto do_sleep;
 		}
 
+		if (!s_shared_checked) {
+			s_shared_checked = true;
+			try {
+				s_shared_valid = map_shared_levels(conn, s_shared_levels);
+			} catch (...) {
+				s_shared_valid = false;
+			}
+		}
+
+		// Meters with a shared memory slot are read directly, only the rest needs IPC.
+		if (s_shared_valid) {
+			std::unique_lock<std::mutex> ul(s_worker_lock);
+			obs::VolMeterSharedSlot*     slots = obs::VolMeterSharedSlots(s_shared_levels.data());
+
+			need_ipc = false;
+			for (auto& kv : s_subscribers) {
+				uint32_t slot_index = obs::VolMeterSharedSlotIndex(kv.first);
+				if (slot_index >= obs::VolMeterSharedSlotCount) {
+					need_ipc = true;
+					continue;
+				}
+
+				obs::VolMeterLevels levels;
+				uint32_t            seq;
+				if (!slots[slot_index].read(levels, seq) || (levels.id != kv.first)) {
+					continue;
+				}
+				if (seq == kv.second->m_last_sequence) {
+					continue;
+				}
+				kv.second->m_last_sequence = seq;
+				kv.second->queue_levels(levels);
+			}
+		}
+		if (!need_ipc) {
+			goto do_sleep;
+		}
+
 		// Call
 		try {
-			std::unique_lock<std::mutex> ul(m_worker_lock);
+			// Regular ticks only fetch meters that received audio since the last call, a full
+			// snapshot is requested when a meter subscribed or a previous call failed.
+			bool resync = s_resync.exchange(false);
 
-			if (!m_async_callback)
-				goto do_sleep;
-
-			std::vector<ipc::value> response = conn->call_synchronous_helper(
-			    "VolMeter",
-			    "Query",
-			    {
-			        ipc::value(m_uid),
-			    });
+			std::vector<ipc::value> response =
+			    conn->call_synchronous_helper("VolMeter", resync ? "QueryAll" : "QueryEvents", {});
 			if (!response.size()) {
+				s_resync = true;
 				goto do_sleep;
 			}
 			if ((response.size() == 1) && (response[0].type == ipc::type::Null)) {
+				s_resync = true;
 				goto do_sleep;
 			}
 
 			ErrorCode error = (ErrorCode)response[0].value_union.ui64;
-			if (error == ErrorCode::Ok) {
-				std::shared_ptr<osn::VolMeterData> data     = std::make_shared<osn::VolMeterData>();
-				size_t                             channels = response[1].value_union.i32;
-				data->magnitude.resize(channels);
-				data->peak.resize(channels);
-				data->input_peak.resize(channels);
-				data->param = this;
-				for (size_t ch = 0; ch < channels; ch++) {
-					data->magnitude[ch]  = response[1 + ch * 3 + 0].value_union.fp32;
-					data->peak[ch]       = response[1 + ch * 3 + 1].value_union.fp32;
-					data->input_peak[ch] = response[1 + ch * 3 + 2].value_union.fp32;
-				}
-				m_async_callback->queue(std::move(data));
-			} else if(error == ErrorCode::InvalidReference) {
+			if (error != ErrorCode::Ok) {
+				std::cerr << "Failed VolMeter" << std::endl;
+				s_resync = true;
 				goto do_sleep;
 			}
-			else
-			{
-				std::cerr << "Failed VolMeter" << std::endl;
-				break;
+
+			std::unique_lock<std::mutex> ul(s_worker_lock);
+			size_t                       count  = response[1].value_union.ui32;
+			size_t                       offset = 0;
+			for (size_t idx = 0; idx < count; idx++) {
+				obs::VolMeterLevels levels;
+				if (!levels.read(response[2].value_bin, offset)) {
+					break;
+				}
+
+				// Already delivered through shared memory.
+				if (s_shared_valid && (obs::VolMeterSharedSlotIndex(levels.id) < obs::VolMeterSharedSlotCount)) {
+					continue;
+				}
+
+				auto iter = s_subscribers.find(levels.id);
+				if (iter != s_subscribers.end()) {
+					iter->second->queue_levels(levels);
+				}
 			}
 		} catch (std::exception e) {
+			s_resync = true;
 			goto do_sleep;
 		}
 
 	do_sleep:
-		auto tp_end  = std::chrono::high_resolution_clock::now();
-		auto dur     = std::chrono::duration_cast<std::chrono::milliseconds>(tp_end - tp_start);
-		totalSleepMS = m_sleep_interval - dur.count();
-		std::this_thread::sleep_for(std::chrono::milliseconds(totalSleepMS));
+		auto tp_end = std::chrono::high_resolution_clock::now();
+		auto dur    = std::chrono::duration_cast<std::chrono::milliseconds>(tp_end - tp_start);
+		if (dur.count() < int64_t(sleep_interval)) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(sleep_interval - dur.count()));
+		}
 	}
 }
 
@@ -17,9 +17,14 @@
 ******************************************************************************/
 
 #pragma once
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <nan.h>
 #include <node.h>
 #include <thread>
+#include "obs-volmeter-levels.hpp"
+#include "util-shared-memory.hpp"
 #include "utility-v8.hpp"
 
 namespace osn
@@ -44,14 +49,23 @@ namespace osn
 
 		uint64_t m_uid;
 		uint32_t m_sleep_interval = 33;
+		uint32_t m_last_sequence  = 0;
 
-		std::thread m_worker;
-		bool        m_worker_stop = true;
-		std::mutex  m_worker_lock;
+		std::mutex m_worker_lock;
 
 		osn::VolMeterCallback* m_async_callback = nullptr;
 		Nan::Callback          m_callback_function;
 
+		// A single worker serves all meters, from shared memory if possible and IPC otherwise.
+		static std::thread                        s_worker;
+		static std::atomic<bool>                  s_worker_stop;
+		static std::atomic<bool>                  s_resync;
+		static util::shared_memory                s_shared_levels;
+		static bool                               s_shared_checked;
+		static bool                               s_shared_valid;
+		static std::mutex                         s_worker_lock;
+		static std::map<uint64_t, osn::VolMeter*> s_subscribers;
+
 		public:
 		VolMeter(uint64_t uid);
 		~VolMeter();
@@ -62,9 +76,10 @@ namespace osn
 		void stop_async_runner();
 		void callback_handler(void* data, std::shared_ptr<osn::VolMeterData> item);
 
-		void start_worker();
-		void stop_worker();
-		void worker();
+		void        queue_levels(obs::VolMeterLevels& levels);
+		void        start_worker();
+		void        stop_worker();
+		static void worker();
 
 		void set_keepalive(v8::Local<v8::Object>);
 
@@ -17,12 +17,15 @@
 ******************************************************************************/
 
 #include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <inttypes.h>
 #include <iostream>
 #include <ipc-class.hpp>
 #include <ipc-function.hpp>
 #include <ipc-server.hpp>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include "error.hpp"
@@ -31,6 +34,8 @@
 #include "nodeobs_content.h"
 #include "nodeobs_service.h"
 #include "nodeobs_settings.h"
+#include "osn-batch.hpp"
+#include "osn-callstats.hpp"
 #include "osn-fader.hpp"
 #include "osn-filter.hpp"
 #include "osn-global.hpp"
@@ -43,6 +48,7 @@
 #include "osn-transition.hpp"
 #include "osn-video.hpp"
 #include "osn-volmeter.hpp"
+#include "util-server-ready.hpp"
 
 #ifndef _DEBUG
 #include "client/crash_report_database.h"
@@ -94,11 +100,15 @@ extern "C" __declspec(dllexport) DWORD NvOptimusEnablement = [] {
 
 #define BUFFSIZE 512
 
+#define IDLE_TIMEOUT_MS 5000
+
 struct ServerData
 {
 	std::mutex                                     mtx;
+	std::condition_variable                        cv;
 	std::chrono::high_resolution_clock::time_point last_connect, last_disconnect;
 	size_t                                         count_connected = 0;
+	bool                                           shutdown        = false;
 };
 
 bool ServerConnectHandler(void* data, int64_t)
@@ -107,6 +117,7 @@ bool ServerConnectHandler(void* data, int64_t)
 	std::unique_lock<std::mutex> ulock(sd->mtx);
 	sd->last_connect = std::chrono::high_resolution_clock::now();
 	sd->count_connected++;
+	sd->cv.notify_all();
 	return true;
 }
 
@@ -116,6 +127,7 @@ void ServerDisconnectHandler(void* data, int64_t)
 	std::unique_lock<std::mutex> ulock(sd->mtx);
 	sd->last_disconnect = std::chrono::high_resolution_clock::now();
 	sd->count_connected--;
+	sd->cv.notify_all();
 }
 
 namespace System
@@ -123,8 +135,16 @@ namespace System
 	static void
 	    Shutdown(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval)
 	{
-		bool* shutdown = (bool*)data;
-		*shutdown      = true;
+		ServerData*                  sd = reinterpret_cast<ServerData*>(data);
+		std::unique_lock<std::mutex> ulock(sd->mtx);
+		sd->shutdown = true;
+		sd->cv.notify_all();
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+		return;
+	}
+
+	static void Ping(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval)
+	{
 		rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 		return;
 	}
@@ -212,7 +232,6 @@ int main(int argc, char* argv[])
 
 	// Instance
 	ipc::server myServer;
-	bool        doShutdown = false;
 	ServerData  sd;
 	sd.last_disconnect = sd.last_connect = std::chrono::high_resolution_clock::now();
 	sd.count_connected                   = 0;
@@ -222,8 +241,17 @@ int main(int argc, char* argv[])
 	{
 		std::shared_ptr<ipc::collection> cls = std::make_shared<ipc::collection>("System");
 		cls->register_function(
-		    std::make_shared<ipc::function>("Shutdown", std::vector<ipc::type>{}, System::Shutdown, &doShutdown));
+		    std::make_shared<ipc::function>("Shutdown", std::vector<ipc::type>{}, System::Shutdown, &sd));
+		cls->register_function(
+		    std::make_shared<ipc::function>("GetCallStats", std::vector<ipc::type>{}, osn::CallStats::Query));
+		cls->register_function(std::make_shared<ipc::function>(
+		    "StartTrace", std::vector<ipc::type>{ipc::type::String}, osn::CallStats::StartTrace));
+		cls->register_function(
+		    std::make_shared<ipc::function>("StopTrace", std::vector<ipc::type>{}, osn::CallStats::StopTrace));
+		cls->register_function(std::make_shared<ipc::function>("Ping", std::vector<ipc::type>{}, System::Ping));
+		osn::CallStats::DeclareConcurrent(cls, {"GetCallStats", "Ping"});
 		myServer.register_collection(cls);
+		osn::CallStats::Instrument(cls);
 	};
 
 	/// OBS Studio Node
@@ -245,6 +273,13 @@ int main(int argc, char* argv[])
 	OBS_settings::Register(myServer);
 	OBS_settings::Register(myServer);
 	autoConfig::Register(myServer);
+	osn::Batch::Register(myServer);
+
+	// Allow tracing a whole session, including startup, without client changes.
+	const char* trace_path = std::getenv("OSN_IPC_TRACE");
+	if (trace_path && !osn::CallStats::OpenTrace(trace_path)) {
+		std::cerr << "Failed to open IPC trace file " << trace_path << "." << std::endl;
+	}
 
 	// Register Connect/Disconnect Handlers
 	myServer.set_connect_handler(ServerConnectHandler, &sd);
@@ -289,21 +324,40 @@ int main(int argc, char* argv[])
 		return -2;
 	}
 
-	// Reset Connect/Disconnect time.
-	sd.last_disconnect = sd.last_connect = std::chrono::high_resolution_clock::now();
+#if defined(_WIN32)
+	// Let the client that spawned us connect now that the socket is listening.
+	HANDLE ready = OpenEventA(EVENT_MODIFY_STATE, FALSE, util::server_ready::event_name(argv[1]).c_str());
+	if (ready) {
+		SetEvent(ready);
+		CloseHandle(ready);
+	}
+#endif
 
 	bool waitBeforeClosing = false;
 
-	while (!doShutdown) {
-		if (sd.count_connected == 0) {
-			auto tp    = std::chrono::high_resolution_clock::now();
-			auto delta = tp - sd.last_disconnect;
-			if (std::chrono::duration_cast<std::chrono::milliseconds>(delta).count() > 5000) {
-				doShutdown = true;
+	// Sleep until told to shut down or until no client was connected for the idle timeout.
+	{
+		std::unique_lock<std::mutex> ulock(sd.mtx);
+
+		// Reset Connect/Disconnect time.
+		sd.last_disconnect = sd.last_connect = std::chrono::high_resolution_clock::now();
+
+		while (!sd.shutdown) {
+			if (sd.count_connected > 0) {
+				sd.cv.wait(ulock, [&sd]() { return sd.shutdown || (sd.count_connected == 0); });
+				continue;
+			}
+
+			auto deadline = sd.last_disconnect + std::chrono::milliseconds(IDLE_TIMEOUT_MS);
+			sd.cv.wait_until(ulock, deadline, [&sd]() { return sd.shutdown || (sd.count_connected > 0); });
+
+			// A client may have come and gone while we waited, which moves the deadline.
+			auto idle_for = std::chrono::high_resolution_clock::now() - sd.last_disconnect;
+			if (!sd.shutdown && (sd.count_connected == 0) && (idle_for >= std::chrono::milliseconds(IDLE_TIMEOUT_MS))) {
+				sd.shutdown       = true;
 				waitBeforeClosing = true;
 			}
 		}
-		std::this_thread::sleep_for(std::chrono::milliseconds(50));
 	}
 
 	// Wait on receive the exit message from the crash-handler
@@ -333,6 +387,7 @@ int main(int argc, char* argv[])
 	}
 
 	osn::Source::finalize_global_signals();
+	osn::Source::finalize_type_info();
 	OBS_API::destroyOBS_API();
 
 	// Finalize Server
@@ -17,9 +17,11 @@
 ******************************************************************************/
 
 #include "nodeobs_api.h"
+#include "osn-batch.hpp"
 #include "osn-source.hpp"
 #include "osn-volmeter.hpp"
 #include "osn-fader.hpp"
+#include "osn-video.hpp"
 #include "util/lexer.h"
 
 #ifdef _WIN32
@@ -91,6 +93,7 @@ void OBS_API::Register(ipc::server& srv)
 	    ProcessHotkeyStatus));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void replaceAll(std::string& str, const std::string& from, const std::string& to)
@@ -559,6 +562,9 @@ void OBS_API::OBS_API_initAPI(
 
 	setAudioDeviceMonitoring();
 
+	// Look up source type defaults now, so asking for them later doesn't wait on plugin code.
+	osn::Source::initialize_type_info();
+
 	// Enable the hotkey callback rerouting that will be used when manually handling hotkeys on the frontend
 	obs_hotkey_enable_callback_rerouting(true);
 
@@ -583,6 +589,7 @@ void OBS_API::OBS_API_destroyOBS_API(
 	//  osn::Source::Manager.
 	osn::Source::finalize_global_signals();
 	/* END INJECT osn::Source::Manager */
+	osn::Source::finalize_type_info();
 	destroyOBS_API();
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 	AUTO_DEBUG;
@@ -1032,7 +1039,7 @@ void OBS_API::destroyOBS_API(void)
     osn::VolMeter::ClearVolmeters();
     osn::Fader::ClearFaders();
 
-	obs_shutdown();
+	osn::Video::Shutdown();
 
 	// Release each obs module (dlls for windows)
 	// TODO: We should release these modules (dlls) manually and not let the garbage
@@ -18,6 +18,8 @@
 
 #include "nodeobs_autoconfig.h"
 #include "error.hpp"
+#include "osn-batch.hpp"
+#include "osn-video.hpp"
 #include "shared.hpp"
 
 enum class Type
@@ -189,7 +191,7 @@ class TestMode
 			obs_set_output_source(i, source[i]);
 
 		obs_remove_main_render_callback(render_rand, this);
-		obs_reset_video(&ovi);
+		osn::Video::Reset(&ovi);
 	}
 
 	inline void SetVideo(int cx, int cy, int fps_num, int fps_den)
@@ -201,7 +203,7 @@ class TestMode
 		newOVI.fps_num       = (uint32_t)fps_num;
 		newOVI.fps_den       = (uint32_t)fps_den;
 
-		obs_reset_video(&newOVI);
+		osn::Video::Reset(&newOVI);
 	}
 };
 
@@ -232,6 +234,7 @@ void autoConfig::Register(ipc::server& srv)
 	cls->register_function(std::make_shared<ipc::function>("Query", std::vector<ipc::type>{}, autoConfig::Query));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void autoConfig::TestHardwareEncoding(void)
@@ -592,7 +595,7 @@ void autoConfig::TestBandwidthThread(void)
 	ovi.fps_num       = 60;
 	ovi.fps_den       = 1;
 
-	obs_reset_video(&ovi);
+	osn::Video::Reset(&ovi);
 
 	const char* serverType = "rtmp_common";
 
@@ -1087,7 +1090,7 @@ bool autoConfig::TestSoftwareEncoding()
 		ovi.fps_num       = fps_num;
 		ovi.fps_den       = fps_den;
 
-		obs_reset_video(&ovi);
+		osn::Video::Reset(&ovi);
 
 		obs_encoder_set_video(vencoder, obs_get_video());
 		obs_encoder_set_audio(aencoder, obs_get_audio());
@@ -1337,7 +1340,7 @@ bool autoConfig::CheckSettings(void)
 	ovi.fps_num       = idealFPSNum;
 	ovi.fps_den       = 1;
 
-	obs_reset_video(&ovi);
+	osn::Video::Reset(&ovi);
 
 	OBSEncoder vencoder = obs_video_encoder_create(GetEncoderId(streamingEncoder), "test_encoder", nullptr, nullptr);
 	OBSEncoder aencoder = obs_audio_encoder_create("ffmpeg_aac", "test_aac", nullptr, 0, nullptr);
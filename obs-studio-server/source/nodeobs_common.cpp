@@ -25,6 +25,7 @@
 #include <graphics/matrix4.h>
 
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include "shared.hpp"
 
 #include <thread>
@@ -195,6 +196,7 @@ void OBS_content::Register(ipc::server& srv)
 	    OBS_content_setDrawGuideLines));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void popupAeroDisabledWindow(void)
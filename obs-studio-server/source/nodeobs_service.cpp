@@ -21,6 +21,8 @@
 #include <filesystem>
 #include <windows.h>
 #include "error.hpp"
+#include "osn-batch.hpp"
+#include "osn-video.hpp"
 #include "shared.hpp"
 
 obs_output_t* streamingOutput    = nullptr;
@@ -81,6 +83,7 @@ void OBS_service::Register(ipc::server& srv)
 	    "OBS_service_getLastReplay", std::vector<ipc::type>{}, OBS_service_getLastReplay));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void OBS_service::OBS_service_resetAudioContext(
@@ -479,7 +482,7 @@ int OBS_service::resetVideoContext(bool reload)
 	config_save_safe(ConfigManager::getInstance().getBasic(), "tmp", nullptr);
 
 	try {
-		return obs_reset_video(&ovi);
+		return osn::Video::Reset(&ovi);
 	} catch (const char* error) {
 		blog(LOG_ERROR, error);
 		return OBS_VIDEO_FAIL;
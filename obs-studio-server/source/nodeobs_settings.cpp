@@ -19,6 +19,7 @@
 #include "nodeobs_settings.h"
 #include "error.hpp"
 #include "nodeobs_api.h"
+#include "osn-batch.hpp"
 #include "shared.hpp"
 
 #include <windows.h>
@@ -55,6 +56,7 @@ void OBS_settings::Register(ipc::server& srv)
 	    "OBS_settings_getListCategories", std::vector<ipc::type>{}, OBS_settings_getListCategories));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void OBS_settings::OBS_settings_getListCategories(
@@ -98,109 +100,6 @@ void OBS_settings::OBS_settings_getSettings(
 	AUTO_DEBUG;
 }
 
-std::vector<SubCategory> serializeCategory(uint32_t subCategoriesCount, uint32_t sizeStruct, std::vector<char> buffer)
-{
-	std::vector<SubCategory> category;
-
-	size_t indexData = 0;
-	for (uint32_t i = 0; i < subCategoriesCount; i++) {
-		SubCategory sc;
-
-		size_t* sizeMessage = reinterpret_cast<size_t*>(buffer.data() + indexData);
-		indexData += sizeof(size_t);
-
-		std::string name(buffer.data() + indexData, *sizeMessage);
-		indexData += *sizeMessage;
-
-		uint32_t* paramsCount = reinterpret_cast<uint32_t*>(buffer.data() + indexData);
-		indexData += sizeof(uint32_t);
-
-		Parameter param;
-		for (uint32_t j = 0; j < *paramsCount; j++) {
-			size_t* sizeName = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			std::string name(buffer.data() + indexData, *sizeName);
-			indexData += *sizeName;
-
-			size_t* sizeDescription = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			std::string description(buffer.data() + indexData, *sizeDescription);
-			indexData += *sizeDescription;
-
-			size_t* sizeType = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			std::string type(buffer.data() + indexData, *sizeType);
-			indexData += *sizeType;
-
-			size_t* sizeSubType = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			std::string subType(buffer.data() + indexData, *sizeSubType);
-			indexData += *sizeSubType;
-
-			bool* enabled = reinterpret_cast<bool*>(buffer.data() + indexData);
-			indexData += sizeof(bool);
-
-			bool* masked = reinterpret_cast<bool*>(buffer.data() + indexData);
-			indexData += sizeof(bool);
-
-			bool* visible = reinterpret_cast<bool*>(buffer.data() + indexData);
-			indexData += sizeof(bool);
-
-			double* minVal = reinterpret_cast<double*>(buffer.data() + indexData);
-			indexData += sizeof(double);
-
-			double* maxVal = reinterpret_cast<double*>(buffer.data() + indexData);
-			indexData += sizeof(double);
-
-			double* stepVal = reinterpret_cast<double*>(buffer.data() + indexData);
-			indexData += sizeof(double);
-
-			size_t* sizeOfCurrentValue = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			std::vector<char> currentValue;
-			currentValue.resize(*sizeOfCurrentValue);
-			memcpy(currentValue.data(), buffer.data() + indexData, *sizeOfCurrentValue);
-			indexData += *sizeOfCurrentValue;
-
-			size_t* sizeOfValues = reinterpret_cast<size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			size_t* countValues = reinterpret_cast<size_t*>(buffer.data() + indexData);
-			indexData += sizeof(size_t);
-
-			std::vector<char> values;
-			values.resize(*sizeOfValues);
-			memcpy(values.data(), buffer.data() + indexData, *sizeOfValues);
-			indexData += *sizeOfValues;
-
-			param.name         = name;
-			param.description  = description;
-			param.type         = type;
-			param.subType      = subType;
-			param.enabled      = *enabled;
-			param.masked       = *masked;
-			param.visible      = *visible;
-			param.minVal       = *minVal;
-			param.maxVal       = *maxVal;
-			param.stepVal      = *stepVal;
-			param.currentValue = currentValue;
-			param.values       = values;
-			param.countValues  = *countValues;
-
-			sc.params.push_back(param);
-		}
-		sc.name        = name;
-		sc.paramsCount = *paramsCount;
-		category.push_back(sc);
-	}
-	return category;
-}
-
 void OBS_settings::OBS_settings_saveSettings(
     void*                          data,
     const int64_t                  id,
@@ -211,11 +110,14 @@ void OBS_settings::OBS_settings_saveSettings(
 	uint32_t    subCategoriesCount = args[1].value_union.ui32;
 	uint32_t    sizeStruct         = args[2].value_union.ui32;
 
-	std::vector<char> buffer;
-	buffer.resize(sizeStruct);
-	memcpy(buffer.data(), args[3].value_bin.data(), sizeStruct);
-
-	std::vector<SubCategory> settings = serializeCategory(subCategoriesCount, sizeStruct, buffer);
+	std::vector<SubCategory> settings;
+	if ((sizeStruct > args[3].value_bin.size())
+	    || !serializeCategory(subCategoriesCount, args[3].value_bin.data(), sizeStruct, settings)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+		rval.push_back(ipc::value("Malformed settings for category '" + nameCategory + "'."));
+		AUTO_DEBUG;
+		return;
+	}
 
 	saveSettings(nameCategory, settings);
 
@@ -2469,12 +2371,12 @@ std::vector<SubCategory> OBS_settings::getOutputSettings(CategoryTypes &type)
 	return outputSettings;
 }
 
-void OBS_settings::saveSimpleOutputSettings(std::vector<SubCategory> settings)
+void OBS_settings::saveSimpleOutputSettings(std::vector<SubCategory>& settings)
 {
 	saveGenericSettings(settings, "SimpleOutput", ConfigManager::getInstance().getBasic());
 }
 
-void OBS_settings::saveAdvancedOutputStreamingSettings(std::vector<SubCategory> settings)
+void OBS_settings::saveAdvancedOutputStreamingSettings(std::vector<SubCategory>& settings)
 {
 	int indexStreamingCategory = 1;
 
@@ -2487,10 +2389,8 @@ void OBS_settings::saveAdvancedOutputStreamingSettings(std::vector<SubCategory>
 
 	bool newEncoderType = false;
 
-	Parameter param;
-
 	for (int i = 0; i < settings.at(indexStreamingCategory).params.size(); i++) {
-		param = settings.at(indexStreamingCategory).params.at(i);
+		Parameter& param = settings.at(indexStreamingCategory).params.at(i);
 
 		std::string name = param.name;
 		std::string type = param.type;
@@ -2587,7 +2487,7 @@ void OBS_settings::saveAdvancedOutputStreamingSettings(std::vector<SubCategory>
 	}
 }
 
-void OBS_settings::saveAdvancedOutputRecordingSettings(std::vector<SubCategory> settings)
+void OBS_settings::saveAdvancedOutputRecordingSettings(std::vector<SubCategory>& settings)
 {
 	int         indexRecordingCategory = 2;
 	std::string section                = "AdvOut";
@@ -2599,10 +2499,8 @@ void OBS_settings::saveAdvancedOutputRecordingSettings(std::vector<SubCategory>
 
 	bool newEncoderType = false;
 
-	Parameter param;
-
 	for (int i = 0; i < settings.at(indexRecordingCategory).params.size(); i++) {
-		param = settings.at(indexRecordingCategory).params.at(i);
+		Parameter& param = settings.at(indexRecordingCategory).params.at(i);
 
 		std::string name = param.name;
 		std::string type = param.type;
@@ -2712,7 +2610,7 @@ void OBS_settings::saveAdvancedOutputRecordingSettings(std::vector<SubCategory>
 	}
 }
 
-void OBS_settings::saveAdvancedOutputSettings(std::vector<SubCategory> settings)
+void OBS_settings::saveAdvancedOutputSettings(std::vector<SubCategory>& settings)
 {
 	// Streaming
 	if (!obs_output_active(OBS_service::getStreamingOutput()))
@@ -2728,23 +2626,23 @@ void OBS_settings::saveAdvancedOutputSettings(std::vector<SubCategory> settings)
 		int                      indexTrack = 3;
 
 		for (int i = 0; i < 6; i++) {
-			audioSettings.push_back(settings.at(i + indexTrack));
+			audioSettings.push_back(std::move(settings.at(i + indexTrack)));
 		}
 		saveGenericSettings(audioSettings, "AdvOut", ConfigManager::getInstance().getBasic());
 	}
 
 	// Replay buffer
 	std::vector<SubCategory> replaySettings;
-	replaySettings.push_back(settings.at(9));
+	replaySettings.push_back(std::move(settings.at(9)));
 	saveGenericSettings(replaySettings, "AdvOut", ConfigManager::getInstance().getBasic());
 }
 
 bool useAdvancedOutput;
 
-void OBS_settings::saveOutputSettings(std::vector<SubCategory> settings)
+void OBS_settings::saveOutputSettings(std::vector<SubCategory>& settings)
 {
 	// Get selected output mode
-	Parameter   outputMode = settings.at(0).params.at(0);
+	Parameter&  outputMode = settings.at(0).params.at(0);
 	std::string currentOutputMode(outputMode.currentValue.data(), outputMode.currentValue.size());
 
 	config_set_string(ConfigManager::getInstance().getBasic(), "Output", "Mode", currentOutputMode.c_str());
@@ -3681,7 +3579,7 @@ std::vector<SubCategory> OBS_settings::getSettings(std::string nameCategory, Cat
 	return settings;
 }
 
-void OBS_settings::saveSettings(std::string nameCategory, std::vector<SubCategory> settings)
+void OBS_settings::saveSettings(std::string nameCategory, std::vector<SubCategory>& settings)
 {
 	if (nameCategory.compare("General") == 0) {
 		saveGenericSettings(settings, "BasicWindow", ConfigManager::getInstance().getGlobal());
@@ -3705,19 +3603,18 @@ void OBS_settings::saveSettings(std::string nameCategory, std::vector<SubCategor
 	}
 }
 
-void OBS_settings::saveGenericSettings(std::vector<SubCategory> genericSettings, std::string section, config_t* config)
+void OBS_settings::saveGenericSettings(
+    std::vector<SubCategory>& genericSettings,
+    std::string               section,
+    config_t*                 config)
 {
-	SubCategory sc;
-
 	for (int i = 0; i < genericSettings.size(); i++) {
-		sc = genericSettings.at(i);
+		SubCategory& sc = genericSettings.at(i);
 
 		std::string nameSubcategory = sc.name;
 
-		Parameter param;
-
 		for (int j = 0; j < sc.params.size(); j++) {
-			param = sc.params.at(j);
+			Parameter& param = sc.params.at(j);
 
 			std::string name    = param.name;
 			std::string type    = param.type;
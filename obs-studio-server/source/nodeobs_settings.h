@@ -26,6 +26,7 @@
 #include "nodeobs_service.h"
 
 #include "nodeobs_audio_encoders.h"
+#include "nodeobs_settings_category.h"
 
 enum CategoryTypes : uint32_t
 {
@@ -33,118 +34,6 @@ enum CategoryTypes : uint32_t
 	NODEOBS_CATEGORY_TAB = 1
 };
 
-struct Parameter
-{
-	std::string       name;
-	std::string       description;
-	std::string       type;
-	std::string       subType;
-	bool              enabled;
-	bool              masked;
-	bool              visible;
-	double            minVal = -200;
-	double            maxVal = 200;
-	double            stepVal = 1;
-	size_t            sizeOfCurrentValue = 0;
-	std::vector<char> currentValue;
-	size_t            sizeOfValues = 0;
-	size_t            countValues  = 0;
-	std::vector<char> values;
-
-	std::vector<char> serialize()
-	{
-		std::vector<char> buffer;
-		size_t            indexBuffer = 0;
-
-		size_t sizeStruct = name.length() + description.length() + type.length() + subType.length() + sizeof(size_t) * 7
-		                    + sizeof(bool) * 3 + sizeof(double) * 3 + sizeOfCurrentValue + sizeOfValues;
-		buffer.resize(sizeStruct);
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = name.length();
-		indexBuffer += sizeof(size_t);
-		memcpy(buffer.data() + indexBuffer, name.data(), name.length());
-		indexBuffer += name.length();
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = description.length();
-		indexBuffer += sizeof(size_t);
-		memcpy(buffer.data() + indexBuffer, description.data(), description.length());
-		indexBuffer += description.length();
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = type.length();
-		indexBuffer += sizeof(size_t);
-		memcpy(buffer.data() + indexBuffer, type.data(), type.length());
-		indexBuffer += type.length();
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = subType.length();
-		indexBuffer += sizeof(size_t);
-		memcpy(buffer.data() + indexBuffer, subType.data(), subType.length());
-		indexBuffer += subType.length();
-
-		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = enabled;
-		indexBuffer += sizeof(bool);
-		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = masked;
-		indexBuffer += sizeof(bool);
-		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = visible;
-		indexBuffer += sizeof(bool);
-
-		*reinterpret_cast<double*>(buffer.data() + indexBuffer) = minVal;
-		indexBuffer += sizeof(double);
-		*reinterpret_cast<double*>(buffer.data() + indexBuffer) = maxVal;
-		indexBuffer += sizeof(double);
-		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = stepVal;
-		indexBuffer += sizeof(double);
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = sizeOfCurrentValue;
-		indexBuffer += sizeof(size_t);
-
-		memcpy(buffer.data() + indexBuffer, currentValue.data(), sizeOfCurrentValue);
-		indexBuffer += sizeOfCurrentValue;
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = sizeOfValues;
-		indexBuffer += sizeof(size_t);
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = countValues;
-		indexBuffer += sizeof(size_t);
-
-		memcpy(buffer.data() + indexBuffer, values.data(), sizeOfValues);
-		indexBuffer += sizeOfValues;
-
-		return buffer;
-	}
-};
-
-struct SubCategory
-{
-	std::string            name;
-	size_t                 paramsCount = 0;
-	std::vector<Parameter> params;
-
-	std::vector<char> serialize()
-	{
-		std::vector<char> buffer;
-		size_t            indexBuffer = 0;
-
-		size_t sizeStruct = name.length() + sizeof(size_t) + sizeof(size_t);
-		buffer.resize(sizeStruct);
-
-		*reinterpret_cast<size_t*>(buffer.data()) = name.length();
-		indexBuffer += sizeof(size_t);
-		memcpy(buffer.data() + indexBuffer, name.data(), name.length());
-		indexBuffer += name.length();
-
-		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = paramsCount;
-		indexBuffer += sizeof(size_t);
-
-		for (int i = 0; i < params.size(); i++) {
-			std::vector<char> serializedBuf = params.at(i).serialize();
-
-			buffer.insert(buffer.end(), serializedBuf.begin(), serializedBuf.end());
-		}
-
-		return buffer;
-	}
-};
-
 class OBS_settings
 {
 	public:
@@ -174,7 +63,7 @@ class OBS_settings
 
 	// Exposed methods to the frontend
 	static std::vector<SubCategory> getSettings(std::string nameCategory, CategoryTypes&);
-	static void                     saveSettings(std::string nameCategory, std::vector<SubCategory> settings);
+	static void                     saveSettings(std::string nameCategory, std::vector<SubCategory>& settings);
 
 	// Get each category
 	static std::vector<SubCategory> getGeneralSettings();
@@ -187,12 +76,13 @@ class OBS_settings
 	// Save each category
 	static void saveGeneralSettings(std::vector<SubCategory> generalSettings, std::string pathConfigDirectory);
 	static void saveStreamSettings(std::vector<SubCategory> streamSettings);
-	static void saveOutputSettings(std::vector<SubCategory> streamSettings);
+	static void saveOutputSettings(std::vector<SubCategory>& streamSettings);
 	static void saveAudioSettings(std::vector<SubCategory> audioSettings);
 	static void saveVideoSettings(std::vector<SubCategory> videoSettings);
 	static void saveAdvancedSettings(std::vector<SubCategory> advancedSettings);
 
-	static void saveGenericSettings(std::vector<SubCategory> genericSettings, std::string section, config_t* config);
+	static void
+	    saveGenericSettings(std::vector<SubCategory>& genericSettings, std::string section, config_t* config);
 
 	static SubCategory serializeSettingsData(
 	    std::string                                                   nameSubCategory,
@@ -234,14 +124,14 @@ class OBS_settings
 	/****** Save Output Settings ******/
 
 	// Simple Output mode
-	static void saveSimpleOutputSettings(std::vector<SubCategory> settings);
+	static void saveSimpleOutputSettings(std::vector<SubCategory>& settings);
 
 	// Advanced Output mode
-	static void saveAdvancedOutputStreamingSettings(std::vector<SubCategory> settings);
+	static void saveAdvancedOutputStreamingSettings(std::vector<SubCategory>& settings);
 
-	static void saveAdvancedOutputRecordingSettings(std::vector<SubCategory> settings);
+	static void saveAdvancedOutputRecordingSettings(std::vector<SubCategory>& settings);
 
-	static void saveAdvancedOutputSettings(std::vector<SubCategory> settings);
+	static void saveAdvancedOutputSettings(std::vector<SubCategory>& settings);
 
 	//Utility functions
 	static void getSimpleAvailableEncoders(std::vector<std::pair<std::string, ipc::value>>* streamEncode, bool recording);
@@ -0,0 +1,222 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Parameter
+{
+	std::string       name;
+	std::string       description;
+	std::string       type;
+	std::string       subType;
+	bool              enabled;
+	bool              masked;
+	bool              visible;
+	double            minVal = -200;
+	double            maxVal = 200;
+	double            stepVal = 1;
+	size_t            sizeOfCurrentValue = 0;
+	std::vector<char> currentValue;
+	size_t            sizeOfValues = 0;
+	size_t            countValues  = 0;
+	std::vector<char> values;
+
+	std::vector<char> serialize()
+	{
+		std::vector<char> buffer;
+		size_t            indexBuffer = 0;
+
+		size_t sizeStruct = name.length() + description.length() + type.length() + subType.length() + sizeof(size_t) * 7
+		                    + sizeof(bool) * 3 + sizeof(double) * 3 + sizeOfCurrentValue + sizeOfValues;
+		buffer.resize(sizeStruct);
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = name.length();
+		indexBuffer += sizeof(size_t);
+		memcpy(buffer.data() + indexBuffer, name.data(), name.length());
+		indexBuffer += name.length();
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = description.length();
+		indexBuffer += sizeof(size_t);
+		memcpy(buffer.data() + indexBuffer, description.data(), description.length());
+		indexBuffer += description.length();
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = type.length();
+		indexBuffer += sizeof(size_t);
+		memcpy(buffer.data() + indexBuffer, type.data(), type.length());
+		indexBuffer += type.length();
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = subType.length();
+		indexBuffer += sizeof(size_t);
+		memcpy(buffer.data() + indexBuffer, subType.data(), subType.length());
+		indexBuffer += subType.length();
+
+		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = enabled;
+		indexBuffer += sizeof(bool);
+		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = masked;
+		indexBuffer += sizeof(bool);
+		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = visible;
+		indexBuffer += sizeof(bool);
+
+		*reinterpret_cast<double*>(buffer.data() + indexBuffer) = minVal;
+		indexBuffer += sizeof(double);
+		*reinterpret_cast<double*>(buffer.data() + indexBuffer) = maxVal;
+		indexBuffer += sizeof(double);
+		*reinterpret_cast<bool*>(buffer.data() + indexBuffer) = stepVal;
+		indexBuffer += sizeof(double);
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = sizeOfCurrentValue;
+		indexBuffer += sizeof(size_t);
+
+		memcpy(buffer.data() + indexBuffer, currentValue.data(), sizeOfCurrentValue);
+		indexBuffer += sizeOfCurrentValue;
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = sizeOfValues;
+		indexBuffer += sizeof(size_t);
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = countValues;
+		indexBuffer += sizeof(size_t);
+
+		memcpy(buffer.data() + indexBuffer, values.data(), sizeOfValues);
+		indexBuffer += sizeOfValues;
+
+		return buffer;
+	}
+};
+
+struct SubCategory
+{
+	std::string            name;
+	size_t                 paramsCount = 0;
+	std::vector<Parameter> params;
+
+	std::vector<char> serialize()
+	{
+		std::vector<char> buffer;
+		size_t            indexBuffer = 0;
+
+		size_t sizeStruct = name.length() + sizeof(size_t) + sizeof(size_t);
+		buffer.resize(sizeStruct);
+
+		*reinterpret_cast<size_t*>(buffer.data()) = name.length();
+		indexBuffer += sizeof(size_t);
+		memcpy(buffer.data() + indexBuffer, name.data(), name.length());
+		indexBuffer += name.length();
+
+		*reinterpret_cast<size_t*>(buffer.data() + indexBuffer) = paramsCount;
+		indexBuffer += sizeof(size_t);
+
+		for (size_t i = 0; i < params.size(); i++) {
+			std::vector<char> serializedBuf = params.at(i).serialize();
+
+			buffer.insert(buffer.end(), serializedBuf.begin(), serializedBuf.end());
+		}
+
+		return buffer;
+	}
+};
+
+// Reads fields straight out of the received buffer without taking a copy of it.
+//  Values are copied out with memcpy as the buffer gives no alignment guarantees.
+class SettingsReader
+{
+	const char* m_data;
+	size_t      m_size;
+	size_t      m_offset = 0;
+
+	public:
+	SettingsReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+	size_t remaining()
+	{
+		return m_size - m_offset;
+	}
+
+	template<typename T>
+	bool read(T& value)
+	{
+		if (m_size - m_offset < sizeof(T))
+			return false;
+		memcpy(&value, m_data + m_offset, sizeof(T));
+		m_offset += sizeof(T);
+		return true;
+	}
+
+	bool read(std::string& value)
+	{
+		size_t length = 0;
+		if (!read(length) || (m_size - m_offset < length))
+			return false;
+		value.assign(m_data + m_offset, length);
+		m_offset += length;
+		return true;
+	}
+
+	bool read(std::vector<char>& value, size_t length)
+	{
+		if (m_size - m_offset < length)
+			return false;
+		value.assign(m_data + m_offset, m_data + m_offset + length);
+		m_offset += length;
+		return true;
+	}
+};
+
+inline bool serializeCategory(
+    uint32_t                  subCategoriesCount,
+    const char*               data,
+    size_t                    size,
+    std::vector<SubCategory>& category)
+{
+	// Smallest encoding of a subcategory (empty name, no parameters) and of a parameter
+	//  (empty strings and values). The counts are untrusted, so space is only reserved
+	//  for as many entries as the remaining bytes can hold.
+	const size_t minSubCategorySize = sizeof(size_t) + sizeof(uint32_t);
+	const size_t minParameterSize   = sizeof(size_t) * 7 + sizeof(bool) * 3 + sizeof(double) * 3;
+
+	SettingsReader reader(data, size);
+
+	category.reserve(std::min<size_t>(subCategoriesCount, reader.remaining() / minSubCategorySize));
+	for (uint32_t i = 0; i < subCategoriesCount; i++) {
+		SubCategory sc;
+		uint32_t    paramsCount = 0;
+		if (!reader.read(sc.name) || !reader.read(paramsCount))
+			return false;
+
+		sc.paramsCount = paramsCount;
+		sc.params.reserve(std::min<size_t>(paramsCount, reader.remaining() / minParameterSize));
+		for (uint32_t j = 0; j < paramsCount; j++) {
+			Parameter param;
+			if (!reader.read(param.name) || !reader.read(param.description) || !reader.read(param.type)
+			    || !reader.read(param.subType) || !reader.read(param.enabled) || !reader.read(param.masked)
+			    || !reader.read(param.visible) || !reader.read(param.minVal) || !reader.read(param.maxVal)
+			    || !reader.read(param.stepVal) || !reader.read(param.sizeOfCurrentValue)
+			    || !reader.read(param.currentValue, param.sizeOfCurrentValue) || !reader.read(param.sizeOfValues)
+			    || !reader.read(param.countValues) || !reader.read(param.values, param.sizeOfValues))
+				return false;
+
+			sc.params.push_back(std::move(param));
+		}
+		category.push_back(std::move(sc));
+	}
+	return true;
+}
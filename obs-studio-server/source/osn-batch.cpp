@@ -0,0 +1,103 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "osn-batch.hpp"
+#include <ipc-function.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+#include "error.hpp"
+#include "osn-callstats.hpp"
+#include "shared.hpp"
+#include "util-ipc-batch.hpp"
+
+static std::mutex                                              collections_mtx;
+static std::map<std::string, std::shared_ptr<ipc::collection>> collections;
+
+void osn::Batch::Register(ipc::server& srv)
+{
+	std::shared_ptr<ipc::collection> cls = std::make_shared<ipc::collection>("Batch");
+	cls->register_function(std::make_shared<ipc::function>("Call", std::vector<ipc::type>{ipc::type::Binary}, Call));
+	srv.register_collection(cls);
+	osn::CallStats::Instrument(cls);
+}
+
+void osn::Batch::Track(std::shared_ptr<ipc::collection> cls)
+{
+	osn::CallStats::Instrument(cls);
+
+	std::unique_lock<std::mutex> ul(collections_mtx);
+	collections.insert_or_assign(cls->get_name(), cls);
+}
+
+void osn::Batch::Call(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	std::vector<util::ipc_batch::call_t> calls;
+	if (!util::ipc_batch::read_calls(args[0].value_bin, calls)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+		rval.push_back(ipc::value("Malformed batch."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	// Calls run in order and a failing call does not stop the batch, every
+	//  call gets its own result list just like a single call would.
+	std::vector<std::vector<ipc::value>> results(calls.size());
+	for (size_t idx = 0; idx < calls.size(); idx++) {
+		util::ipc_batch::call_t&         call   = calls[idx];
+		std::vector<ipc::value>&         result = results[idx];
+		std::shared_ptr<ipc::collection> cls;
+
+		{
+			std::unique_lock<std::mutex> ul(collections_mtx);
+			auto                         iter = collections.find(call.collection);
+			if (iter != collections.end()) {
+				cls = iter->second;
+			}
+		}
+		if (!cls) {
+			result.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+			result.push_back(ipc::value("Collection '" + call.collection + "' not found."));
+			continue;
+		}
+
+		std::shared_ptr<ipc::function> fn = cls->get_function(call.function, call.args);
+		if (!fn) {
+			result.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+			result.push_back(ipc::value("Function '" + call.collection + "." + call.function + "' not found."));
+			continue;
+		}
+
+		try {
+			fn->call(id, call.args, result);
+		} catch (const std::exception& e) {
+			result.clear();
+			result.push_back(ipc::value((uint64_t)ErrorCode::Error));
+			result.push_back(ipc::value(std::string("Batched call failed: ") + e.what()));
+		}
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(uint32_t(results.size())));
+	rval.push_back(ipc::value(util::ipc_batch::write_results(results)));
+	AUTO_DEBUG;
+}
@@ -0,0 +1,41 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <ipc-class.hpp>
+#include <ipc-server.hpp>
+#include <memory>
+
+namespace osn
+{
+	class Batch
+	{
+		public:
+		static void Register(ipc::server&);
+
+		// Makes the functions of a registered collection available to batched
+		//  calls and instruments them for System.GetCallStats.
+		static void Track(std::shared_ptr<ipc::collection> cls);
+
+		static void Call(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
+	};
+} // namespace osn
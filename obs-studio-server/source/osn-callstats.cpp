@@ -0,0 +1,277 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "osn-callstats.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ipc-function.hpp>
+#include <list>
+#include <mutex>
+#include <set>
+#include <string>
+#include "error.hpp"
+#include "shared.hpp"
+#include "util-ipc-trace.hpp"
+
+// Latencies are kept in power-of-two nanosecond buckets, which is cheap to
+//  update from any thread and accurate enough to tell slow calls apart.
+static const size_t LatencyBuckets = 40;
+
+struct CallStatsEntry
+{
+	std::string                    collection;
+	std::string                    name;
+	std::shared_ptr<ipc::function> function;
+	bool                           concurrent = false;
+
+	std::atomic<uint64_t>                              count          = {0};
+	std::atomic<uint64_t>                              total_ns       = {0};
+	std::atomic<uint64_t>                              max_ns         = {0};
+	std::atomic<uint64_t>                              request_bytes  = {0};
+	std::atomic<uint64_t>                              response_bytes = {0};
+	std::array<std::atomic<uint64_t>, LatencyBuckets> buckets;
+
+	CallStatsEntry()
+	{
+		for (auto& bucket : buckets)
+			bucket = 0;
+	}
+};
+
+static std::mutex                entries_mtx;
+static std::list<CallStatsEntry> entries;
+static std::set<std::string>     concurrent_functions;
+
+// Each connection is served by its own thread. Everything that was not
+//  declared concurrent still runs one call at a time, recursive so that
+//  batched calls can run their nested calls.
+static std::recursive_mutex serial_mtx;
+
+// Tracing records top-level calls only, calls made from inside a batch are
+//  already part of the batch arguments. System calls are never recorded, and
+//  neither are functions declared concurrent: they run outside serial_mtx, so
+//  their order relative to other calls is not reproducible on replay.
+//  trace_start is published by the release store to tracing.
+static util::ipc_trace::writer                        trace;
+static std::atomic<bool>                              tracing = {false};
+static std::chrono::high_resolution_clock::time_point trace_start;
+static thread_local uint32_t                          call_depth = 0;
+
+struct CallDepthGuard
+{
+	CallDepthGuard()
+	{
+		call_depth++;
+	}
+	~CallDepthGuard()
+	{
+		call_depth--;
+	}
+};
+
+static size_t ValueSize(const ipc::value& value)
+{
+	switch (value.type) {
+	case ipc::type::Float:
+	case ipc::type::Int32:
+	case ipc::type::UInt32:
+		return sizeof(uint32_t);
+	case ipc::type::Double:
+	case ipc::type::Int64:
+	case ipc::type::UInt64:
+		return sizeof(uint64_t);
+	case ipc::type::String:
+		return value.value_str.size();
+	case ipc::type::Binary:
+		return value.value_bin.size();
+	default:
+		return 0;
+	}
+}
+
+static size_t ValuesSize(const std::vector<ipc::value>& values)
+{
+	size_t size = 0;
+	for (const ipc::value& value : values)
+		size += ValueSize(value);
+	return size;
+}
+
+static size_t BucketOf(uint64_t ns)
+{
+	size_t bucket = 0;
+	while ((ns >>= 1) && (bucket < (LatencyBuckets - 1)))
+		bucket++;
+	return bucket;
+}
+
+static uint64_t Percentile(const CallStatsEntry& entry, uint64_t count, double percentile)
+{
+	uint64_t threshold = uint64_t(double(count) * percentile);
+	uint64_t seen      = 0;
+	for (size_t idx = 0; idx < LatencyBuckets; idx++) {
+		seen += entry.buckets[idx].load(std::memory_order_relaxed);
+		if (seen > threshold)
+			return std::min(uint64_t(2) << idx, entry.max_ns.load(std::memory_order_relaxed));
+	}
+	return entry.max_ns.load(std::memory_order_relaxed);
+}
+
+static void
+    InstrumentedCall(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval)
+{
+	CallStatsEntry* entry = reinterpret_cast<CallStatsEntry*>(data);
+
+	std::unique_lock<std::recursive_mutex> ul(serial_mtx, std::defer_lock);
+	if (!entry->concurrent)
+		ul.lock();
+
+	auto start = std::chrono::high_resolution_clock::now();
+	{
+		CallDepthGuard guard;
+		entry->function->call(id, args, rval);
+	}
+	uint64_t ns = uint64_t(
+	    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start)
+	        .count());
+
+	if (tracing.load(std::memory_order_acquire) && (call_depth == 0) && !entry->concurrent
+	    && (entry->collection != "System")) {
+		util::ipc_trace::record_t record;
+		record.start_ns =
+		    uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(start - trace_start).count());
+		record.duration_ns = ns;
+		record.call        = {entry->collection, entry->function->get_name(), args};
+		trace.write(record);
+	}
+
+	entry->count.fetch_add(1, std::memory_order_relaxed);
+	entry->total_ns.fetch_add(ns, std::memory_order_relaxed);
+	entry->buckets[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+	entry->request_bytes.fetch_add(ValuesSize(args), std::memory_order_relaxed);
+	entry->response_bytes.fetch_add(ValuesSize(rval), std::memory_order_relaxed);
+
+	uint64_t max_ns = entry->max_ns.load(std::memory_order_relaxed);
+	while ((ns > max_ns) && !entry->max_ns.compare_exchange_weak(max_ns, ns, std::memory_order_relaxed)) {
+	}
+}
+
+void osn::CallStats::Instrument(std::shared_ptr<ipc::collection> cls)
+{
+	std::vector<std::shared_ptr<ipc::function>> functions;
+	for (size_t idx = 0; idx < cls->count_functions(); idx++) {
+		functions.push_back(cls->get_function(idx));
+	}
+
+	std::unique_lock<std::mutex> ul(entries_mtx);
+	for (std::shared_ptr<ipc::function> fn : functions) {
+		std::vector<ipc::type> params;
+		for (size_t idx = 0; idx < fn->count_parameters(); idx++) {
+			params.push_back(fn->get_parameter_type(idx));
+		}
+
+		// The original function stays alive inside the entry and is called from the wrapper.
+		entries.emplace_back();
+		CallStatsEntry& entry = entries.back();
+		entry.collection      = cls->get_name();
+		entry.name            = cls->get_name() + "." + fn->get_name();
+		entry.function        = fn;
+		entry.concurrent      = (concurrent_functions.count(entry.name) > 0);
+
+		cls->unregister_function(fn);
+		cls->register_function(std::make_shared<ipc::function>(fn->get_name(), params, InstrumentedCall, &entry));
+	}
+}
+
+void osn::CallStats::DeclareConcurrent(
+    std::shared_ptr<ipc::collection> cls,
+    const std::vector<std::string>&  functions)
+{
+	std::unique_lock<std::mutex> ul(entries_mtx);
+	for (const std::string& function : functions) {
+		concurrent_functions.insert(cls->get_name() + "." + function);
+	}
+}
+
+void osn::CallStats::Query(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+
+	std::unique_lock<std::mutex> ul(entries_mtx);
+	rval.push_back(ipc::value(uint32_t(entries.size())));
+	for (const CallStatsEntry& entry : entries) {
+		uint64_t count = entry.count.load(std::memory_order_relaxed);
+		rval.push_back(ipc::value(entry.name));
+		rval.push_back(ipc::value(count));
+		rval.push_back(ipc::value(entry.total_ns.load(std::memory_order_relaxed)));
+		rval.push_back(ipc::value(Percentile(entry, count, 0.50)));
+		rval.push_back(ipc::value(Percentile(entry, count, 0.90)));
+		rval.push_back(ipc::value(Percentile(entry, count, 0.99)));
+		rval.push_back(ipc::value(entry.max_ns.load(std::memory_order_relaxed)));
+		rval.push_back(ipc::value(entry.request_bytes.load(std::memory_order_relaxed)));
+		rval.push_back(ipc::value(entry.response_bytes.load(std::memory_order_relaxed)));
+	}
+	AUTO_DEBUG;
+}
+
+bool osn::CallStats::OpenTrace(const std::string& path)
+{
+	tracing.store(false, std::memory_order_release);
+	if (!trace.open(path))
+		return false;
+
+	trace_start = std::chrono::high_resolution_clock::now();
+	tracing.store(true, std::memory_order_release);
+	return true;
+}
+
+void osn::CallStats::StartTrace(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	if (!OpenTrace(args[0].value_str)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+		rval.push_back(ipc::value("Failed to open trace file '" + args[0].value_str + "'."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	AUTO_DEBUG;
+}
+
+void osn::CallStats::StopTrace(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	tracing.store(false, std::memory_order_release);
+	trace.close();
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	AUTO_DEBUG;
+}
@@ -0,0 +1,61 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <ipc-class.hpp>
+#include <ipc-server.hpp>
+#include <memory>
+#include <string>
+
+namespace osn
+{
+	class CallStats
+	{
+		public:
+		// Wraps every function of a registered collection with timing and size accounting.
+		//  Calls to functions not declared concurrent are serialized across all
+		//  connections, so only declared functions may run in parallel.
+		static void Instrument(std::shared_ptr<ipc::collection> cls);
+
+		// Declares functions that are safe to run at the same time as any other
+		//  call. Must be called before the collection is instrumented.
+		static void
+		    DeclareConcurrent(std::shared_ptr<ipc::collection> cls, const std::vector<std::string>& functions);
+
+		static void Query(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
+
+		// Records every top-level call with its arguments and timing to a
+		//  trace file that bench-ipc-replay in tools/benchmarks can run against a fresh server.
+		static bool OpenTrace(const std::string& path);
+
+		static void StartTrace(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
+		static void StopTrace(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
+	};
+} // namespace osn
@@ -19,6 +19,7 @@
 #include "osn-fader.hpp"
 #include "error.hpp"
 #include "obs.h"
+#include "osn-batch.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
 #include "utility.hpp"
@@ -56,6 +57,7 @@ void osn::Fader::Register(ipc::server& srv)
 	cls->register_function(
 	    std::make_shared<ipc::function>("RemoveCallback", std::vector<ipc::type>{ipc::type::UInt64}, RemoveCallback));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Fader::ClearFaders()
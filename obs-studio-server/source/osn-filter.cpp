@@ -21,6 +21,7 @@
 #include <memory>
 #include <obs.h>
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
 
@@ -33,6 +34,7 @@ void osn::Filter::Register(ipc::server& srv)
 	cls->register_function(std::make_shared<ipc::function>(
 	    "Create", std::vector<ipc::type>{ipc::type::String, ipc::type::String, ipc::type::String}, Create));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Filter::Types(
@@ -19,7 +19,10 @@
 #include "osn-global.hpp"
 #include <error.hpp>
 #include <obs.h>
+#include "osn-batch.hpp"
+#include "osn-callstats.hpp"
 #include "osn-source.hpp"
+#include "osn-video.hpp"
 #include "shared.hpp"
 
 void osn::Global::Register(ipc::server& srv)
@@ -33,10 +36,12 @@ void osn::Global::Register(ipc::server& srv)
 	    "GetOutputFlagsFromId", std::vector<ipc::type>{ipc::type::String}, GetOutputFlagsFromId));
 	cls->register_function(std::make_shared<ipc::function>("LaggedFrames", std::vector<ipc::type>{}, LaggedFrames));
 	cls->register_function(std::make_shared<ipc::function>("TotalFrames", std::vector<ipc::type>{}, TotalFrames));
+	osn::CallStats::DeclareConcurrent(cls, {"LaggedFrames", "TotalFrames"});
 	cls->register_function(std::make_shared<ipc::function>("GetLocale", std::vector<ipc::type>{}, GetLocale));
 	cls->register_function(
 	    std::make_shared<ipc::function>("SetLocale", std::vector<ipc::type>{ipc::type::String}, SetLocale));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Global::GetOutputSource(
@@ -128,7 +133,7 @@ void osn::Global::LaggedFrames(
     std::vector<ipc::value>&       rval)
 {
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
-	rval.push_back(ipc::value(obs_get_lagged_frames()));
+	rval.push_back(ipc::value(osn::Video::LaggedFrames()));
 	AUTO_DEBUG;
 }
 
@@ -139,7 +144,7 @@ void osn::Global::TotalFrames(
     std::vector<ipc::value>&       rval)
 {
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
-	rval.push_back(ipc::value(obs_get_total_frames()));
+	rval.push_back(ipc::value(osn::Video::TotalFrames()));
 	AUTO_DEBUG;
 }
 
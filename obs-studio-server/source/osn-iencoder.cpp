@@ -18,6 +18,7 @@
 
 #include "osn-IEncoder.hpp"
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include <obs.h>
 
 void osn::IEncoder::Register(ipc::server& srv)
@@ -43,6 +44,7 @@ void osn::IEncoder::Register(ipc::server& srv)
 	cls->register_function(
 	    std::make_shared<ipc::function>("Release", std::vector<ipc::type>{ipc::type::String}, &Release));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::IEncoder::GetId(
@@ -19,9 +19,13 @@
 #include "osn-Input.hpp"
 #include <iostream>
 #include <ipc-server.hpp>
+#include <cstring>
+#include <map>
 #include <memory>
 #include <obs.h>
+#include <string>
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
 
@@ -47,6 +51,9 @@ void osn::Input::Register(ipc::server& srv)
 	    std::make_shared<ipc::function>("FromName", std::vector<ipc::type>{ipc::type::String}, FromName));
 	cls->register_function(
 	    std::make_shared<ipc::function>("GetPublicSources", std::vector<ipc::type>{}, GetPublicSources));
+	cls->register_function(std::make_shared<ipc::function>("GetSnapshot", std::vector<ipc::type>{}, GetSnapshot));
+	cls->register_function(
+	    std::make_shared<ipc::function>("GetSnapshot", std::vector<ipc::type>{ipc::type::Binary}, GetSnapshot));
 
 	cls->register_function(
 	    std::make_shared<ipc::function>("Duplicate", std::vector<ipc::type>{ipc::type::UInt64}, Duplicate));
@@ -103,6 +110,7 @@ void osn::Input::Register(ipc::server& srv)
 	    "CopyFiltersTo", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::UInt64}, CopyFiltersTo));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Input::Types(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval)
@@ -309,6 +317,111 @@ void osn::Input::GetPublicSources(
 	AUTO_DEBUG;
 }
 
+template<typename T>
+static ipc::value PackColumn(const std::vector<T>& column)
+{
+	std::vector<char> buf(column.size() * sizeof(T));
+	if (!column.empty())
+		memcpy(buf.data(), column.data(), buf.size());
+	return ipc::value(buf);
+}
+
+void osn::Input::GetSnapshot(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	// Without arguments every public input is included, otherwise the
+	//  sources whose ids are packed as uint64 in the given buffer, in order.
+	std::vector<obs_source_t*> sources;
+	if (args.empty()) {
+		auto enum_cb = [](void* data, obs_source_t* source) {
+			if (osn::Source::Manager::GetInstance().find(source) != UINT64_MAX)
+				static_cast<std::vector<obs_source_t*>*>(data)->push_back(source);
+			return true;
+		};
+		obs_enum_sources(enum_cb, &sources);
+	} else {
+		const std::vector<char>& ids   = args[0].value_bin;
+		size_t                   count = ids.size() / sizeof(uint64_t);
+		sources.reserve(count);
+		for (size_t idx = 0; idx < count; idx++) {
+			uint64_t uid;
+			memcpy(&uid, ids.data() + idx * sizeof(uint64_t), sizeof(uint64_t));
+
+			obs_source_t* source = osn::Source::Manager::GetInstance().find(uid);
+			if (!source) {
+				rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+				rval.push_back(ipc::value("Source reference is not valid."));
+				AUTO_DEBUG;
+				return;
+			}
+			sources.push_back(source);
+		}
+	}
+
+	// Names and type ids go into one string table, columns refer to it by
+	//  index so repeated type ids are only sent once.
+	std::vector<char>               strings;
+	std::map<std::string, uint32_t> string_index;
+	auto                            intern = [&](const char* str) {
+		std::string value = str ? str : "";
+		auto        found = string_index.find(value);
+		if (found != string_index.end())
+			return found->second;
+
+		uint32_t index = uint32_t(string_index.size());
+		strings.insert(strings.end(), value.begin(), value.end());
+		strings.push_back('\0');
+		string_index.emplace(value, index);
+		return index;
+	};
+
+	size_t                count = sources.size();
+	std::vector<uint32_t> names(count), types(count), flags(count), output_flags(count), widths(count),
+	    heights(count);
+	std::vector<uint8_t>  muted(count), enabled(count), active(count), showing(count);
+	std::vector<float>    volumes(count);
+	std::vector<int32_t>  monitoring_types(count);
+	std::vector<uint64_t> source_ids(count);
+
+	for (size_t idx = 0; idx < count; idx++) {
+		obs_source_t* source  = sources[idx];
+		source_ids[idx]       = osn::Source::Manager::GetInstance().find(source);
+		names[idx]            = intern(obs_source_get_name(source));
+		types[idx]            = intern(obs_source_get_id(source));
+		flags[idx]            = obs_source_get_flags(source);
+		output_flags[idx]     = obs_source_get_output_flags(source);
+		muted[idx]            = obs_source_muted(source);
+		enabled[idx]          = obs_source_enabled(source);
+		active[idx]           = obs_source_active(source);
+		showing[idx]          = obs_source_showing(source);
+		volumes[idx]          = obs_source_get_volume(source);
+		monitoring_types[idx] = int32_t(obs_source_get_monitoring_type(source));
+		widths[idx]           = obs_source_get_width(source);
+		heights[idx]          = obs_source_get_height(source);
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(uint32_t(count)));
+	rval.push_back(ipc::value(strings));
+	rval.push_back(PackColumn(names));
+	rval.push_back(PackColumn(types));
+	rval.push_back(PackColumn(flags));
+	rval.push_back(PackColumn(output_flags));
+	rval.push_back(PackColumn(muted));
+	rval.push_back(PackColumn(enabled));
+	rval.push_back(PackColumn(active));
+	rval.push_back(PackColumn(showing));
+	rval.push_back(PackColumn(volumes));
+	rval.push_back(PackColumn(monitoring_types));
+	rval.push_back(PackColumn(widths));
+	rval.push_back(PackColumn(heights));
+	rval.push_back(PackColumn(source_ids));
+	AUTO_DEBUG;
+}
+
 void osn::Input::GetActive(
     void*                          data,
     const int64_t                  id,
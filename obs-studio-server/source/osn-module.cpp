@@ -18,6 +18,7 @@
 
 #include "osn-module.hpp"
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include "shared.hpp"
 
 void osn::Module::Register(ipc::server& srv)
@@ -46,6 +47,7 @@ void osn::Module::Register(ipc::server& srv)
 	    std::make_shared<ipc::function>("GetDataPath", std::vector<ipc::type>{ipc::type::UInt64}, GetDataPath));
 
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Module::Open(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval)
@@ -19,6 +19,7 @@
 #include "osn-Properties.hpp"
 #include "error.hpp"
 #include "obs.h"
+#include "osn-batch.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
 
@@ -30,6 +31,7 @@ void osn::Properties::Register(ipc::server& srv)
 	cls->register_function(std::make_shared<ipc::function>(
 	    "Clicked", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::String}, Clicked));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Properties::Modified(
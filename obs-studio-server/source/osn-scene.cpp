@@ -18,9 +18,106 @@
 
 #include "osn-scene.hpp"
 #include <list>
+#include <map>
+#include <mutex>
+#include <set>
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include "osn-sceneitem.hpp"
 #include "shared.hpp"
+#include "util-scene-snapshot.hpp"
+
+// The items of a scene are versioned as a whole, so GetSnapshot can tell a client that its copy is
+//  still current. Tracking starts with the first snapshot of a scene, no client can hold anything older.
+struct scene_version_t
+{
+	uint64_t version = 1;
+	// Items whose change was already counted by a setter, their next item_transform is not counted again.
+	std::set<obs_sceneitem_t*> expected_transforms;
+};
+static std::mutex                               scene_versions_mtx;
+static std::map<obs_source_t*, scene_version_t> scene_versions;
+static const char*                              scene_item_signals[] = {
+    "item_add", "reorder", "refresh", "item_visible", "item_select", "item_deselect"};
+
+static void scene_changed_cb(void* ptr, calldata_t* cd)
+{
+	std::unique_lock<std::mutex> ul(scene_versions_mtx);
+	auto                         found = scene_versions.find(static_cast<obs_source_t*>(ptr));
+	if (found != scene_versions.end())
+		found->second.version++;
+}
+
+static void scene_item_transform_cb(void* ptr, calldata_t* cd)
+{
+	obs_sceneitem_t* item = static_cast<obs_sceneitem_t*>(calldata_ptr(cd, "item"));
+
+	std::unique_lock<std::mutex> ul(scene_versions_mtx);
+	auto                         found = scene_versions.find(static_cast<obs_source_t*>(ptr));
+	if ((found != scene_versions.end()) && (found->second.expected_transforms.erase(item) == 0))
+		found->second.version++;
+}
+
+static void scene_item_remove_cb(void* ptr, calldata_t* cd)
+{
+	obs_sceneitem_t* item = static_cast<obs_sceneitem_t*>(calldata_ptr(cd, "item"));
+
+	std::unique_lock<std::mutex> ul(scene_versions_mtx);
+	auto                         found = scene_versions.find(static_cast<obs_source_t*>(ptr));
+	if (found != scene_versions.end()) {
+		found->second.version++;
+		found->second.expected_transforms.erase(item);
+	}
+}
+
+static void scene_destroy_cb(void* ptr, calldata_t* cd)
+{
+	std::unique_lock<std::mutex> ul(scene_versions_mtx);
+	scene_versions.erase(static_cast<obs_source_t*>(ptr));
+}
+
+static uint64_t TrackSceneVersion(obs_source_t* source)
+{
+	{
+		std::unique_lock<std::mutex> ul(scene_versions_mtx);
+		auto                         found = scene_versions.find(source);
+		if (found != scene_versions.end())
+			return found->second.version;
+	}
+
+	// Connected without holding scene_versions_mtx, libobs calls the callbacks with its own lock held.
+	signal_handler_t* sh = obs_source_get_signal_handler(source);
+	for (const char* signal : scene_item_signals) {
+		signal_handler_connect(sh, signal, scene_changed_cb, source);
+	}
+	signal_handler_connect(sh, "item_transform", scene_item_transform_cb, source);
+	signal_handler_connect(sh, "item_remove", scene_item_remove_cb, source);
+	signal_handler_connect(sh, "destroy", scene_destroy_cb, source);
+
+	// 0 is reserved for "nothing yet".
+	std::unique_lock<std::mutex> ul(scene_versions_mtx);
+	return scene_versions[source].version;
+}
+
+void osn::Scene::BumpVersion(obs_scene_t* scene)
+{
+	if (scene)
+		scene_changed_cb(obs_scene_get_source(scene), nullptr);
+}
+
+void osn::Scene::BumpTransformVersion(obs_sceneitem_t* item)
+{
+	obs_scene_t* scene = obs_sceneitem_get_scene(item);
+	if (!scene)
+		return;
+
+	std::unique_lock<std::mutex> ul(scene_versions_mtx);
+	auto                         found = scene_versions.find(obs_scene_get_source(scene));
+	if (found != scene_versions.end()) {
+		found->second.version++;
+		found->second.expected_transforms.insert(item);
+	}
+}
 
 void osn::Scene::Register(ipc::server& srv)
 {
@@ -59,11 +156,15 @@ void osn::Scene::Register(ipc::server& srv)
 	    std::vector<ipc::type>{ipc::type::UInt64, ipc::type::Int32, ipc::type::Int32},
 	    GetItemsInRange));
 
+	cls->register_function(std::make_shared<ipc::function>(
+	    "GetSnapshot", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::UInt64}, GetSnapshot));
+
 	cls->register_function(
 	    std::make_shared<ipc::function>("Connect", std::vector<ipc::type>{ipc::type::UInt64}, Connect));
 	cls->register_function(
 	    std::make_shared<ipc::function>("Disconnect", std::vector<ipc::type>{ipc::type::UInt64}, Disconnect));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Scene::Create(
@@ -707,6 +808,100 @@ void osn::Scene::GetItemsInRange(
 	AUTO_DEBUG;
 }
 
+void osn::Scene::GetSnapshot(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	obs_source_t* source = osn::Source::Manager::GetInstance().find(args[0].value_union.ui64);
+	if (!source) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+		rval.push_back(ipc::value("Source reference is not valid."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	obs_scene_t* scene = obs_scene_from_source(source);
+	if (!scene) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+		rval.push_back(ipc::value("Source reference is not a scene."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	// Read before the items, a change made while enumerating then shows up as a newer version.
+	uint64_t version = TrackSceneVersion(source);
+	uint64_t since   = args[1].value_union.ui64;
+	if ((since != 0) && (since == version)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+		rval.push_back(ipc::value(version));
+		AUTO_DEBUG;
+		return;
+	}
+
+	std::list<obs_sceneitem_t*> items;
+	auto                        cb = [](obs_scene_t* scene, obs_sceneitem_t* item, void* data) {
+        std::list<obs_sceneitem_t*>* items = reinterpret_cast<std::list<obs_sceneitem_t*>*>(data);
+        items->push_back(item);
+        return true;
+	};
+	obs_scene_enum_items(scene, cb, &items);
+
+	std::vector<util::scene_snapshot::item_state> states;
+	states.reserve(items.size());
+	for (obs_sceneitem_t* item : items) {
+		utility::unique_id::id_t uid = osn::SceneItem::Manager::GetInstance().find(item);
+		if (uid == UINT64_MAX) {
+			uid = osn::SceneItem::Manager::GetInstance().allocate(item);
+			if (uid == UINT64_MAX) {
+				rval.push_back(ipc::value((uint64_t)ErrorCode::CriticalError));
+				rval.push_back(ipc::value("Index list is full."));
+				AUTO_DEBUG;
+				return;
+			}
+			obs_sceneitem_addref(item);
+		}
+
+		util::scene_snapshot::item_state state = {};
+		vec2                             vec;
+		obs_sceneitem_crop               crop;
+
+		state.item   = uid;
+		state.source = osn::Source::Manager::GetInstance().find(obs_sceneitem_get_source(item));
+		state.id     = obs_sceneitem_get_id(item);
+		obs_sceneitem_get_pos(item, &vec);
+		state.position[0] = vec.x;
+		state.position[1] = vec.y;
+		state.rotation    = obs_sceneitem_get_rot(item);
+		obs_sceneitem_get_scale(item, &vec);
+		state.scale[0]  = vec.x;
+		state.scale[1]  = vec.y;
+		state.alignment = obs_sceneitem_get_alignment(item);
+		obs_sceneitem_get_bounds(item, &vec);
+		state.bounds[0]        = vec.x;
+		state.bounds[1]        = vec.y;
+		state.bounds_type      = obs_sceneitem_get_bounds_type(item);
+		state.bounds_alignment = obs_sceneitem_get_bounds_alignment(item);
+		obs_sceneitem_get_crop(item, &crop);
+		state.crop[0]      = crop.left;
+		state.crop[1]      = crop.top;
+		state.crop[2]      = crop.right;
+		state.crop[3]      = crop.bottom;
+		state.scale_filter = obs_sceneitem_get_scale_filter(item);
+		if (obs_sceneitem_visible(item))
+			state.flags |= util::scene_snapshot::flag_visible;
+		if (obs_sceneitem_selected(item))
+			state.flags |= util::scene_snapshot::flag_selected;
+		states.push_back(state);
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(version));
+	rval.push_back(ipc::value(util::scene_snapshot::pack(states)));
+	AUTO_DEBUG;
+}
+
 void osn::Scene::Connect(
     void*                          data,
     const int64_t                  id,
@@ -70,6 +70,15 @@ namespace osn
 		    const std::vector<ipc::value>& args,
 		    std::vector<ipc::value>&       rval);
 
+		static void
+		    GetSnapshot(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval);
+
+		// Marks the items of a scene as changed for GetSnapshot, for changes libobs does not signal.
+		static void BumpVersion(obs_scene_t* scene);
+		// Same for a change libobs signals with item_transform, which may only happen on the next tick.
+		//  Call before the setter, the signal it causes is then not counted as another change.
+		static void BumpTransformVersion(obs_sceneitem_t* item);
+
 		// Signals?
 		static void
 		            Connect(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval);
@@ -18,6 +18,8 @@
 
 #include "osn-sceneitem.hpp"
 #include <error.hpp>
+#include "osn-batch.hpp"
+#include "osn-scene.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
 
@@ -93,6 +95,7 @@ void osn::SceneItem::Register(ipc::server& srv)
 	cls->register_function(
 	    std::make_shared<ipc::function>("DeferUpdateEnd", std::vector<ipc::type>{ipc::type::UInt64}, DeferUpdateEnd));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::SceneItem::GetSource(
@@ -302,6 +305,7 @@ void osn::SceneItem::SetPosition(
 	pos.x = args[1].value_union.fp32;
 	pos.y = args[2].value_union.fp32;
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_pos(item, &pos);
 	obs_sceneitem_get_pos(item, &pos);
 
@@ -344,6 +348,7 @@ void osn::SceneItem::SetRotation(
 		return;
 	}
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_rot(item, args[1].value_union.fp32);
 
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
@@ -392,6 +397,7 @@ void osn::SceneItem::SetScale(
 	scale.x = args[1].value_union.fp32;
 	scale.y = args[2].value_union.fp32;
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_scale(item, &scale);
 	obs_sceneitem_get_scale(item, &scale);
 
@@ -437,6 +443,7 @@ void osn::SceneItem::SetScaleFilter(
 	}
 
 	obs_sceneitem_set_scale_filter(item, (obs_scale_type)args[1].value_union.i32);
+	osn::Scene::BumpVersion(obs_sceneitem_get_scene(item));
 	obs_scale_type type = obs_sceneitem_get_scale_filter(item);
 
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
@@ -479,6 +486,7 @@ void osn::SceneItem::SetAlignment(
 		return;
 	}
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_alignment(item, args[1].value_union.ui32);
 	uint32_t align = obs_sceneitem_get_alignment(item);
 
@@ -527,6 +535,8 @@ void osn::SceneItem::SetBounds(
 	bounds.x = args[1].value_union.fp32;
 	bounds.y = args[2].value_union.fp32;
 
+	osn::Scene::BumpTransformVersion(item);
+	obs_sceneitem_set_bounds(item, &bounds);
 	obs_sceneitem_get_bounds(item, &bounds);
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 	rval.push_back(ipc::value(bounds.x));
@@ -569,6 +579,7 @@ void osn::SceneItem::SetBoundsAlignment(
 		return;
 	}
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_bounds_alignment(item, args[1].value_union.ui32);
 	uint32_t align = obs_sceneitem_get_bounds_alignment(item);
 
@@ -612,6 +623,7 @@ void osn::SceneItem::SetBoundsType(
 		return;
 	}
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_bounds_type(item, (obs_bounds_type)args[1].value_union.i32);
 	obs_bounds_type bounds = obs_sceneitem_get_bounds_type(item);
 
@@ -665,6 +677,7 @@ void osn::SceneItem::SetCrop(
 	crop.right  = args[3].value_union.i32;
 	crop.bottom = args[4].value_union.i32;
 
+	osn::Scene::BumpTransformVersion(item);
 	obs_sceneitem_set_crop(item, &crop);
 	obs_sceneitem_get_crop(item, &crop);
 
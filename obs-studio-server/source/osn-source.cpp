@@ -21,15 +21,80 @@
 #include <ipc-function.hpp>
 #include <ipc-server.hpp>
 #include <ipc-value.hpp>
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <obs-data.h>
 #include <obs.h>
 #include <obs.hpp>
+#include <string>
 #include "error.hpp"
 #include "obs-property.hpp"
+#include "osn-batch.hpp"
 #include "osn-common.hpp"
 #include "shared.hpp"
+#include "util-data-binary.hpp"
+
+// Settings changes made through Source.Update are versioned per key, so GetSettings can answer
+//  with only the keys changed since a version the client already has.
+struct settings_version_t
+{
+	uint64_t                        version = 1; // 0 is reserved for "everything"
+	std::map<std::string, uint64_t> keys;
+};
+static std::mutex                                  settings_versions_mtx;
+static std::map<obs_source_t*, settings_version_t> settings_versions;
+
+static uint64_t BumpSettingsVersion(obs_source_t* src, obs_data_t* changes)
+{
+	std::unique_lock<std::mutex> ul(settings_versions_mtx);
+	settings_version_t&          state = settings_versions[src];
+
+	state.version++;
+	for (obs_data_item_t* item = obs_data_first(changes); item != nullptr; obs_data_item_next(&item)) {
+		state.keys[obs_data_item_get_name(item)] = state.version;
+	}
+	return state.version;
+}
+
+static void ForgetSettingsVersion(obs_source_t* src)
+{
+	std::unique_lock<std::mutex> ul(settings_versions_mtx);
+	settings_versions.erase(src);
+}
+
+static void CopyDataItem(obs_data_t* dst, obs_data_item_t* item)
+{
+	const char* name = obs_data_item_get_name(item);
+	switch (obs_data_item_gettype(item)) {
+	case OBS_DATA_STRING:
+		obs_data_set_string(dst, name, obs_data_item_get_string(item));
+		break;
+	case OBS_DATA_NUMBER:
+		if (obs_data_item_numtype(item) == OBS_DATA_NUM_INT)
+			obs_data_set_int(dst, name, obs_data_item_get_int(item));
+		else
+			obs_data_set_double(dst, name, obs_data_item_get_double(item));
+		break;
+	case OBS_DATA_BOOLEAN:
+		obs_data_set_bool(dst, name, obs_data_item_get_bool(item));
+		break;
+	case OBS_DATA_OBJECT: {
+		obs_data_t* obj = obs_data_item_get_obj(item);
+		obs_data_set_obj(dst, name, obj);
+		obs_data_release(obj);
+		break;
+	}
+	case OBS_DATA_ARRAY: {
+		obs_data_array_t* arr = obs_data_item_get_array(item);
+		obs_data_set_array(dst, name, arr);
+		obs_data_array_release(arr);
+		break;
+	}
+	}
+}
 
 void osn::Source::initialize_global_signals()
 {
@@ -79,6 +144,154 @@ void osn::Source::global_source_destroy_cb(void* ptr, calldata_t* cd)
 
 	detach_source_signals(source);
 	osn::Source::Manager::GetInstance().free(source);
+	ForgetSettingsVersion(source);
+}
+
+static void EncodeData(obs_data_t* data, util::data_binary::writer& writer)
+{
+	using util::data_binary::type;
+
+	size_t   offset = writer.begin_count();
+	uint32_t count  = 0;
+	for (obs_data_item_t* item = obs_data_first(data); item != nullptr; obs_data_item_next(&item)) {
+		// Same members as obs_data_get_full_json: user values and defaults.
+		if (!obs_data_item_has_user_value(item) && !obs_data_item_has_default_value(item))
+			continue;
+
+		const char* name   = obs_data_item_get_name(item);
+		size_t      length = strlen(name);
+		switch (obs_data_item_gettype(item)) {
+		case OBS_DATA_STRING: {
+			const char* str = obs_data_item_get_string(item);
+			writer.key(name, length, type::String);
+			writer.value_string(str ? str : "", str ? strlen(str) : 0);
+			break;
+		}
+		case OBS_DATA_NUMBER:
+			if (obs_data_item_numtype(item) == OBS_DATA_NUM_INT) {
+				writer.key(name, length, type::Int);
+				writer.value_int(obs_data_item_get_int(item));
+			} else {
+				writer.key(name, length, type::Double);
+				writer.value_double(obs_data_item_get_double(item));
+			}
+			break;
+		case OBS_DATA_BOOLEAN:
+			writer.key(name, length, type::Bool);
+			writer.value_bool(obs_data_item_get_bool(item));
+			break;
+		case OBS_DATA_OBJECT: {
+			obs_data_t* obj = obs_data_item_get_obj(item);
+			writer.key(name, length, type::Object);
+			EncodeData(obj, writer);
+			obs_data_release(obj);
+			break;
+		}
+		case OBS_DATA_ARRAY: {
+			obs_data_array_t* arr       = obs_data_item_get_array(item);
+			size_t            arr_count = obs_data_array_count(arr);
+			writer.key(name, length, type::Array);
+			size_t arr_offset = writer.begin_count();
+			for (size_t idx = 0; idx < arr_count; idx++) {
+				obs_data_t* obj = obs_data_array_item(arr, idx);
+				EncodeData(obj, writer);
+				obs_data_release(obj);
+			}
+			writer.end_count(arr_offset, uint32_t(arr_count));
+			obs_data_array_release(arr);
+			break;
+		}
+		default:
+			continue;
+		}
+		count++;
+	}
+	writer.end_count(offset, count);
+}
+
+static bool DecodeData(util::data_binary::reader& reader, obs_data_t* data)
+{
+	using util::data_binary::type;
+
+	uint32_t count = 0;
+	if (!reader.count(count))
+		return false;
+
+	for (uint32_t idx = 0; idx < count; idx++) {
+		const char* key    = nullptr;
+		size_t      length = 0;
+		type        t;
+		if (!reader.key(key, length, t))
+			return false;
+
+		std::string name(key, length);
+		switch (t) {
+		case type::Null:
+			break;
+		case type::Bool: {
+			bool value;
+			if (!reader.value_bool(value))
+				return false;
+			obs_data_set_bool(data, name.c_str(), value);
+			break;
+		}
+		case type::Int: {
+			int64_t value;
+			if (!reader.value_int(value))
+				return false;
+			obs_data_set_int(data, name.c_str(), value);
+			break;
+		}
+		case type::Double: {
+			double value;
+			if (!reader.value_double(value))
+				return false;
+			obs_data_set_double(data, name.c_str(), value);
+			break;
+		}
+		case type::String: {
+			const char* value;
+			size_t      value_length;
+			if (!reader.value_string(value, value_length))
+				return false;
+			obs_data_set_string(data, name.c_str(), std::string(value, value_length).c_str());
+			break;
+		}
+		case type::Object: {
+			obs_data_t* obj = obs_data_create();
+			bool        ok  = DecodeData(reader, obj);
+			if (ok)
+				obs_data_set_obj(data, name.c_str(), obj);
+			obs_data_release(obj);
+			if (!ok)
+				return false;
+			break;
+		}
+		case type::Array: {
+			uint32_t arr_count = 0;
+			if (!reader.count(arr_count))
+				return false;
+
+			obs_data_array_t* arr = obs_data_array_create();
+			bool              ok  = true;
+			for (uint32_t arr_idx = 0; ok && (arr_idx < arr_count); arr_idx++) {
+				obs_data_t* obj = obs_data_create();
+				ok              = DecodeData(reader, obj);
+				obs_data_array_push_back(arr, obj);
+				obs_data_release(obj);
+			}
+			if (ok)
+				obs_data_set_array(data, name.c_str(), arr);
+			obs_data_array_release(arr);
+			if (!ok)
+				return false;
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	return true;
 }
 
 void osn::Source::Register(ipc::server& srv)
@@ -99,12 +312,28 @@ void osn::Source::Register(ipc::server& srv)
 	    std::make_shared<ipc::function>("IsConfigurable", std::vector<ipc::type>{ipc::type::UInt64}, IsConfigurable));
 	cls->register_function(
 	    std::make_shared<ipc::function>("GetProperties", std::vector<ipc::type>{ipc::type::UInt64}, GetProperties));
+	cls->register_function(std::make_shared<ipc::function>(
+	    "GetProperties", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::UInt64}, GetProperties));
+	cls->register_function(std::make_shared<ipc::function>(
+	    "GetProperties",
+	    std::vector<ipc::type>{ipc::type::UInt64, ipc::type::UInt64, ipc::type::UInt32},
+	    GetProperties));
+	cls->register_function(std::make_shared<ipc::function>(
+	    "GetListItems",
+	    std::vector<ipc::type>{ipc::type::UInt64, ipc::type::String, ipc::type::UInt32, ipc::type::UInt32},
+	    GetListItems));
 	cls->register_function(
 	    std::make_shared<ipc::function>("GetSettings", std::vector<ipc::type>{ipc::type::UInt64}, GetSettings));
+	cls->register_function(std::make_shared<ipc::function>(
+	    "GetSettings", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::UInt64}, GetSettings));
 	cls->register_function(std::make_shared<ipc::function>("Load", std::vector<ipc::type>{ipc::type::UInt64}, Load));
 	cls->register_function(std::make_shared<ipc::function>("Save", std::vector<ipc::type>{ipc::type::UInt64}, Save));
 	cls->register_function(std::make_shared<ipc::function>(
 	    "Update", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::String}, Update));
+	cls->register_function(std::make_shared<ipc::function>(
+	    "Update", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::Binary}, Update));
+	cls->register_function(std::make_shared<ipc::function>(
+	    "GetSettingsBinary", std::vector<ipc::type>{ipc::type::UInt64}, GetSettingsBinary));
 	cls->register_function(
 	    std::make_shared<ipc::function>("GetType", std::vector<ipc::type>{ipc::type::UInt64}, GetType));
 	cls->register_function(
@@ -129,39 +358,7 @@ void osn::Source::Register(ipc::server& srv)
 	cls->register_function(std::make_shared<ipc::function>(
 	    "SetEnabled", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::Int32}, SetEnabled));
 	srv.register_collection(cls);
-}
-
-void osn::Source::GetTypeProperties(
-    void*                          data,
-    const int64_t                  id,
-    const std::vector<ipc::value>& args,
-    std::vector<ipc::value>&       rval)
-{
-	AUTO_DEBUG;
-	// Per Type Properties (doesn't have an object).
-	//obs_get_source_properties();
-}
-
-void osn::Source::GetTypeDefaults(
-    void*                          data,
-    const int64_t                  id,
-    const std::vector<ipc::value>& args,
-    std::vector<ipc::value>&       rval)
-{
-	AUTO_DEBUG;
-	// Per Type Defaults (doesn't have an object)
-	//obs_get_source_defaults();
-}
-
-void osn::Source::GetTypeOutputFlags(
-    void*                          data,
-    const int64_t                  id,
-    const std::vector<ipc::value>& args,
-    std::vector<ipc::value>&       rval)
-{
-	AUTO_DEBUG;
-	// Per Type Defaults (doesn't have an object)
-	//obs_get_source_output_flags();
+	osn::Batch::Track(cls);
 }
 
 void osn::Source::Remove(
@@ -226,109 +423,127 @@ void osn::Source::IsConfigurable(
 	AUTO_DEBUG;
 }
 
-void osn::Source::GetProperties(
-    void*                          data,
-    const int64_t                  id,
-    const std::vector<ipc::value>& args,
-    std::vector<ipc::value>&       rval)
+// Copies up to count items starting at offset, and the total number of items the list has.
+static void FillListItems(obs_property_t* p, obs::ListProperty& prop, size_t offset, size_t count)
 {
-	// Attempt to find the source asked to load.
-	obs_source_t* src = osn::Source::Manager::GetInstance().find(args[0].value_union.ui64);
-	if (src == nullptr) {
-		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
-		rval.push_back(ipc::value("Source reference is not valid."));
-		AUTO_DEBUG;
-		return;
+	const char* buf;
+
+	prop.item_count = obs_property_list_item_count(p);
+	size_t first    = std::min(offset, prop.item_count);
+	size_t last     = first + std::min(count, prop.item_count - first);
+	for (size_t idx = first; idx < last; ++idx) {
+		obs::ListProperty::Item entry;
+		entry.name    = (buf = obs_property_list_item_name(p, idx)) != nullptr ? buf : "";
+		entry.enabled = !obs_property_list_item_disabled(p, idx);
+		switch (prop.format) {
+		case obs::ListProperty::Format::Integer:
+			entry.value_int = obs_property_list_item_int(p, idx);
+			break;
+		case obs::ListProperty::Format::Float:
+			entry.value_float = obs_property_list_item_float(p, idx);
+			break;
+		case obs::ListProperty::Format::String:
+			entry.value_string = (buf = obs_property_list_item_string(p, idx)) != nullptr ? buf : "";
+			break;
+		}
+		prop.items.push_back(std::move(entry));
 	}
+}
 
-	obs_properties_t* prp = obs_source_properties(src);
-	const char*       buf;
+// Fills the fields every property has and appends it to the sheet.
+static bool AppendProperty(obs::PropertyListWriter& writer, obs_property_t* p, obs::Property& prop)
+{
+	prop.name             = obs_property_name(p);
+	prop.description      = obs_property_description(p) ? obs_property_description(p) : "";
+	prop.long_description = obs_property_long_description(p) ? obs_property_long_description(p) : "";
+	prop.enabled          = obs_property_enabled(p);
+	prop.visible          = obs_property_visible(p);
+	return writer.append(prop);
+}
 
-	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+// List properties carry at most page_size items, see Source.GetListItems for the rest.
+//  Each property is built on the stack and written straight into the sheet, see
+//  obs::PropertyListReader for the other end.
+static bool SerializePropertyList(obs_properties_t* prp, std::vector<char>& serialized, size_t page_size = SIZE_MAX)
+{
+	const char* buf;
+
+	obs::PropertyListWriter writer(serialized);
 	for (obs_property_t* p = obs_properties_first(prp); (p != nullptr); obs_property_next(&p)) {
-		std::shared_ptr<obs::Property> prop;
+		bool written = true;
 
 		switch (obs_property_get_type(p)) {
-		case OBS_PROPERTY_BOOL:
-			prop = std::make_shared<obs::BooleanProperty>();
+		case OBS_PROPERTY_BOOL: {
+			obs::BooleanProperty prop;
+			written = AppendProperty(writer, p, prop);
 			break;
+		}
 		case OBS_PROPERTY_INT: {
-			auto prop2        = std::make_shared<obs::IntegerProperty>();
-			prop2->field_type = obs::NumberProperty::NumberType(obs_property_int_type(p));
-			prop2->minimum    = obs_property_int_min(p);
-			prop2->maximum    = obs_property_int_max(p);
-			prop2->step       = obs_property_int_step(p);
-			prop              = prop2;
+			obs::IntegerProperty prop;
+			prop.field_type = obs::NumberProperty::NumberType(obs_property_int_type(p));
+			prop.minimum    = obs_property_int_min(p);
+			prop.maximum    = obs_property_int_max(p);
+			prop.step       = obs_property_int_step(p);
+			written         = AppendProperty(writer, p, prop);
 			break;
 		}
 		case OBS_PROPERTY_FLOAT: {
-			auto prop2        = std::make_shared<obs::FloatProperty>();
-			prop2->field_type = obs::NumberProperty::NumberType(obs_property_float_type(p));
-			prop2->minimum    = obs_property_float_min(p);
-			prop2->maximum    = obs_property_float_max(p);
-			prop2->step       = obs_property_float_step(p);
-			prop              = prop2;
+			obs::FloatProperty prop;
+			prop.field_type = obs::NumberProperty::NumberType(obs_property_float_type(p));
+			prop.minimum    = obs_property_float_min(p);
+			prop.maximum    = obs_property_float_max(p);
+			prop.step       = obs_property_float_step(p);
+			written         = AppendProperty(writer, p, prop);
 			break;
 		}
 		case OBS_PROPERTY_TEXT: {
-			auto prop2        = std::make_shared<obs::TextProperty>();
-			prop2->field_type = obs::TextProperty::TextType(obs_proprety_text_type(p));
-			prop              = prop2;
+			obs::TextProperty prop;
+			prop.field_type = obs::TextProperty::TextType(obs_proprety_text_type(p));
+			written         = AppendProperty(writer, p, prop);
 			break;
 		}
 		case OBS_PROPERTY_PATH: {
-			auto prop2          = std::make_shared<obs::PathProperty>();
-			prop2->field_type   = obs::PathProperty::PathType(obs_property_path_type(p));
-			prop2->filter       = (buf = obs_property_path_filter(p)) != nullptr ? buf : "";
-			prop2->default_path = (buf = obs_property_path_default_path(p)) != nullptr ? buf : "";
-			prop                = prop2;
+			obs::PathProperty prop;
+			prop.field_type   = obs::PathProperty::PathType(obs_property_path_type(p));
+			prop.filter       = (buf = obs_property_path_filter(p)) != nullptr ? buf : "";
+			prop.default_path = (buf = obs_property_path_default_path(p)) != nullptr ? buf : "";
+			written           = AppendProperty(writer, p, prop);
 			break;
 		}
 		case OBS_PROPERTY_LIST: {
-			auto prop2        = std::make_shared<obs::ListProperty>();
-			prop2->field_type = obs::ListProperty::ListType(obs_property_list_type(p));
-			prop2->format     = obs::ListProperty::Format(obs_property_list_format(p));
-			size_t items      = obs_property_list_item_count(p);
-			for (size_t idx = 0; idx < items; ++idx) {
-				obs::ListProperty::Item entry;
-				entry.name    = (buf = obs_property_list_item_name(p, idx)) != nullptr ? buf : "";
-				entry.enabled = !obs_property_list_item_disabled(p, idx);
-				switch (prop2->format) {
-				case obs::ListProperty::Format::Integer:
-					entry.value_int = obs_property_list_item_int(p, idx);
-					break;
-				case obs::ListProperty::Format::Float:
-					entry.value_float = obs_property_list_item_float(p, idx);
-					break;
-				case obs::ListProperty::Format::String:
-					entry.value_string = (buf = obs_property_list_item_string(p, idx)) != nullptr ? buf : "";
-					break;
-				}
-				prop2->items.push_back(std::move(entry));
-			}
-			prop = prop2;
+			obs::ListProperty prop;
+			prop.field_type = obs::ListProperty::ListType(obs_property_list_type(p));
+			prop.format     = obs::ListProperty::Format(obs_property_list_format(p));
+			FillListItems(p, prop, 0, page_size);
+			written = AppendProperty(writer, p, prop);
 			break;
 		}
-		case OBS_PROPERTY_COLOR:
-			prop = std::make_shared<obs::ColorProperty>();
+		case OBS_PROPERTY_COLOR: {
+			obs::ColorProperty prop;
+			written = AppendProperty(writer, p, prop);
 			break;
-		case OBS_PROPERTY_BUTTON:
-			prop = std::make_shared<obs::ButtonProperty>();
+		}
+		case OBS_PROPERTY_BUTTON: {
+			obs::ButtonProperty prop;
+			written = AppendProperty(writer, p, prop);
 			break;
-		case OBS_PROPERTY_FONT:
-			prop = std::make_shared<obs::FontProperty>();
+		}
+		case OBS_PROPERTY_FONT: {
+			obs::FontProperty prop;
+			written = AppendProperty(writer, p, prop);
 			break;
+		}
 		case OBS_PROPERTY_EDITABLE_LIST: {
-			auto prop2          = std::make_shared<obs::EditableListProperty>();
-			prop2->field_type   = obs::EditableListProperty::ListType(obs_property_editable_list_type(p));
-			prop2->filter       = (buf = obs_property_editable_list_filter(p)) != nullptr ? buf : "";
-			prop2->default_path = (buf = obs_property_editable_list_default_path(p)) != nullptr ? buf : "";
-			prop                = prop2;
+			obs::EditableListProperty prop;
+			prop.field_type   = obs::EditableListProperty::ListType(obs_property_editable_list_type(p));
+			prop.filter       = (buf = obs_property_editable_list_filter(p)) != nullptr ? buf : "";
+			prop.default_path = (buf = obs_property_editable_list_default_path(p)) != nullptr ? buf : "";
+			written           = AppendProperty(writer, p, prop);
 			break;
 		}
 		case OBS_PROPERTY_FRAME_RATE: {
-			auto   prop2      = std::make_shared<obs::FrameRateProperty>();
-			size_t num_ranges = obs_property_frame_rate_fps_ranges_count(p);
+			obs::FrameRateProperty prop;
+			size_t                 num_ranges = obs_property_frame_rate_fps_ranges_count(p);
 			for (size_t idx = 0; idx < num_ranges; idx++) {
 				auto min = obs_property_frame_rate_fps_range_min(p, idx),
 				     max = obs_property_frame_rate_fps_range_max(p, idx);
@@ -339,42 +554,268 @@ void osn::Source::GetProperties(
 				range.maximum.first  = max.numerator;
 				range.maximum.second = max.denominator;
 
-				prop2->ranges.push_back(std::move(range));
+				prop.ranges.push_back(std::move(range));
 			}
 
 			size_t num_options = obs_property_frame_rate_options_count(p);
 			for (size_t idx = 0; idx < num_options; idx++) {
-				auto min = obs_property_frame_rate_fps_range_min(p, idx),
-				     max = obs_property_frame_rate_fps_range_max(p, idx);
-
 				obs::FrameRateProperty::Option option;
 				option.name        = (buf = obs_property_frame_rate_option_name(p, idx)) != nullptr ? buf : "";
 				option.description = (buf = obs_property_frame_rate_option_description(p, idx)) != nullptr ? buf : "";
 
-				prop2->options.push_back(std::move(option));
+				prop.options.push_back(std::move(option));
 			}
 
-			prop = prop2;
+			written = AppendProperty(writer, p, prop);
 			break;
 		}
 		}
 
-		if (!prop) {
-			continue;
+		if (!written) {
+			return false;
 		}
+	}
+
+	return true;
+}
+
+static bool SerializeProperties(obs_source_t* src, std::vector<char>& serialized, size_t page_size = SIZE_MAX)
+{
+	obs_properties_t* prp    = obs_source_properties(src);
+	bool              result = SerializePropertyList(prp, serialized, page_size);
+	obs_properties_destroy(prp);
+	return result;
+}
+
+// FNV-1a over the serialized properties, used to tell the client its cached copy is still current.
+static uint64_t HashProperties(std::vector<char> const& serialized)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (char c : serialized) {
+		hash ^= uint8_t(c);
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+// Defaults and output flags only depend on the loaded plugins, so they are looked up once per type
+//  and kept until the API is destroyed. They are filled for every type at the end of OBS_API_initAPI,
+//  on the IPC thread like every other plugin call. Properties are not kept, plugins may list devices
+//  or windows in them which change while the server runs.
+struct type_info_t
+{
+	bool              has_defaults = false;
+	std::vector<char> defaults;
+	uint32_t          output_flags = 0;
+};
+static std::mutex                         type_info_mtx;
+static std::map<std::string, type_info_t> type_info;
+
+// Fails if no source type with that id is registered.
+static bool FillTypeDefaults(const std::string& type, type_info_t& info)
+{
+	if (info.has_defaults)
+		return true;
+
+	obs_data_t* defaults = obs_get_source_defaults(type.c_str());
+	if (!defaults)
+		return false;
 
-		prop->name             = obs_property_name(p);
-		prop->description      = obs_property_description(p) ? obs_property_description(p) : "";
-		prop->long_description = obs_property_long_description(p) ? obs_property_long_description(p) : "";
-		prop->enabled          = obs_property_enabled(p);
-		prop->visible          = obs_property_visible(p);
+	util::data_binary::writer writer(info.defaults);
+	EncodeData(defaults, writer);
+	obs_data_release(defaults);
 
-		std::vector<char> buf(prop->size());
-		if (prop->serialize(buf)) {
-			rval.push_back(ipc::value(buf));
+	info.output_flags = obs_get_source_output_flags(type.c_str());
+	info.has_defaults = true;
+	return true;
+}
+
+static type_info_t* FindTypeInfo(const std::string& type)
+{
+	type_info_t& info = type_info[type];
+	if (!FillTypeDefaults(type, info)) {
+		type_info.erase(type);
+		return nullptr;
+	}
+	return &info;
+}
+
+void osn::Source::initialize_type_info()
+{
+	std::unique_lock<std::mutex> ul(type_info_mtx);
+	const char*                  type = nullptr;
+	for (size_t idx = 0; obs_enum_input_types(idx, &type); idx++)
+		FindTypeInfo(type);
+	for (size_t idx = 0; obs_enum_filter_types(idx, &type); idx++)
+		FindTypeInfo(type);
+	for (size_t idx = 0; obs_enum_transition_types(idx, &type); idx++)
+		FindTypeInfo(type);
+}
+
+void osn::Source::finalize_type_info()
+{
+	std::unique_lock<std::mutex> ul(type_info_mtx);
+	type_info.clear();
+}
+
+void osn::Source::GetTypeProperties(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	{
+		std::unique_lock<std::mutex> ul(type_info_mtx);
+		if (!FindTypeInfo(args[0].value_str)) {
+			rval.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+			rval.push_back(ipc::value("Source type not found."));
+			AUTO_DEBUG;
+			return;
+		}
+	}
+
+	// Per Type Properties (doesn't have an object), asked for every time so lists stay current.
+	std::vector<char> serialized;
+	obs_properties_t* prp    = obs_get_source_properties(args[0].value_str.c_str());
+	bool              result = SerializePropertyList(prp, serialized);
+	obs_properties_destroy(prp);
+	if (!result) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+		rval.push_back(ipc::value("Failed to serialize properties."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(serialized));
+	AUTO_DEBUG;
+}
+
+void osn::Source::GetTypeDefaults(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	std::unique_lock<std::mutex> ul(type_info_mtx);
+	type_info_t*                 info = FindTypeInfo(args[0].value_str);
+	if (!info) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+		rval.push_back(ipc::value("Source type not found."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(info->defaults));
+	AUTO_DEBUG;
+}
+
+void osn::Source::GetTypeOutputFlags(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	std::unique_lock<std::mutex> ul(type_info_mtx);
+	type_info_t*                 info = FindTypeInfo(args[0].value_str);
+	if (!info) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+		rval.push_back(ipc::value("Source type not found."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(info->output_flags));
+	AUTO_DEBUG;
+}
+
+void osn::Source::GetProperties(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	// Attempt to find the source asked to load.
+	obs_source_t* src = osn::Source::Manager::GetInstance().find(args[0].value_union.ui64);
+	if (src == nullptr) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+		rval.push_back(ipc::value("Source reference is not valid."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	// Properties can depend on settings and on the outside world (devices, windows), so they
+	//  are always rebuilt. What a known hash saves is the transfer and the client side parsing.
+	size_t page_size = (args.size() > 2) ? size_t(args[2].value_union.ui32) : SIZE_MAX;
+
+	std::vector<char> serialized;
+	if (!SerializeProperties(src, serialized, page_size)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+		rval.push_back(ipc::value("Failed to serialize source properties."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	if (args.size() > 1) {
+		uint64_t known_hash = args[1].value_union.ui64;
+		uint64_t hash       = HashProperties(serialized);
+		rval.push_back(ipc::value(hash));
+		if ((known_hash != 0) && (known_hash == hash)) {
+			AUTO_DEBUG;
+			return;
 		}
 	}
+	rval.push_back(ipc::value(std::move(serialized)));
+	AUTO_DEBUG;
+}
+
+void osn::Source::GetListItems(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	// Attempt to find the source asked to load.
+	obs_source_t* src = osn::Source::Manager::GetInstance().find(args[0].value_union.ui64);
+	if (src == nullptr) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+		rval.push_back(ipc::value("Source reference is not valid."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	obs_properties_t* prp = obs_source_properties(src);
+	obs_property_t*   p   = obs_properties_get(prp, args[1].value_str.c_str());
+	if ((p == nullptr) || (obs_property_get_type(p) != OBS_PROPERTY_LIST)) {
+		obs_properties_destroy(prp);
+		rval.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+		rval.push_back(ipc::value("List property not found."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	obs::ListProperty prop;
+	prop.name       = obs_property_name(p);
+	prop.enabled    = obs_property_enabled(p);
+	prop.visible    = obs_property_visible(p);
+	prop.field_type = obs::ListProperty::ListType(obs_property_list_type(p));
+	prop.format     = obs::ListProperty::Format(obs_property_list_format(p));
+	FillListItems(p, prop, args[2].value_union.ui32, args[3].value_union.ui32);
 	obs_properties_destroy(prp);
+
+	std::vector<char> serialized(prop.size());
+	if (!prop.serialize(serialized)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+		rval.push_back(ipc::value("Failed to serialize list items."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(std::move(serialized)));
 	AUTO_DEBUG;
 }
 
@@ -393,13 +834,69 @@ void osn::Source::GetSettings(
 		return;
 	}
 
-	obs_data_t* sets = obs_source_get_settings(src);
+	uint64_t since   = (args.size() > 1) ? args[1].value_union.ui64 : 0;
+	uint64_t version = 0;
+	bool     full    = true;
+
+	obs_data_t* sets  = obs_source_get_settings(src);
+	obs_data_t* delta = nullptr;
+	{
+		std::unique_lock<std::mutex> ul(settings_versions_mtx);
+		settings_version_t&          state = settings_versions[src];
+		version                            = state.version;
+
+		// A version we never handed out means the client is out of sync, send everything.
+		if ((since != 0) && (since <= version)) {
+			full  = false;
+			delta = obs_data_create();
+			for (auto& key : state.keys) {
+				if (key.second <= since)
+					continue;
+
+				obs_data_item_t* item = obs_data_item_byname(sets, key.first.c_str());
+				if (item) {
+					CopyDataItem(delta, item);
+					obs_data_item_release(&item);
+				}
+			}
+		}
+	}
+
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
-	rval.push_back(ipc::value(obs_data_get_full_json(sets)));
+	rval.push_back(ipc::value(full ? obs_data_get_full_json(sets) : obs_data_get_json(delta)));
+	rval.push_back(ipc::value(version));
+	rval.push_back(ipc::value((int32_t)full));
+	obs_data_release(delta);
 	obs_data_release(sets);
 	AUTO_DEBUG;
 }
 
+void osn::Source::GetSettingsBinary(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	// Attempt to find the source asked to load.
+	obs_source_t* src = osn::Source::Manager::GetInstance().find(args[0].value_union.ui64);
+	if (src == nullptr) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::InvalidReference));
+		rval.push_back(ipc::value("Source reference is not valid."));
+		AUTO_DEBUG;
+		return;
+	}
+
+	std::vector<char>         buf;
+	util::data_binary::writer writer(buf);
+	obs_data_t*               sets = obs_source_get_settings(src);
+	EncodeData(sets, writer);
+	obs_data_release(sets);
+
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(std::move(buf)));
+	AUTO_DEBUG;
+}
+
 void osn::Source::Update(
     void*                          data,
     const int64_t                  id,
@@ -415,11 +912,27 @@ void osn::Source::Update(
 		return;
 	}
 
-	obs_data_t* sets = obs_data_create_from_json(args[1].value_str.c_str());
+	// Only the keys present are applied, so callers can send just what changed.
+	obs_data_t* sets = nullptr;
+	if (args[1].type == ipc::type::Binary) {
+		util::data_binary::reader reader(args[1].value_bin.data(), args[1].value_bin.size());
+		sets = obs_data_create();
+		if (!DecodeData(reader, sets)) {
+			obs_data_release(sets);
+			rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+			rval.push_back(ipc::value("Malformed settings."));
+			AUTO_DEBUG;
+			return;
+		}
+	} else {
+		sets = obs_data_create_from_json(args[1].value_str.c_str());
+	}
 	obs_source_update(src, sets);
+	uint64_t version = BumpSettingsVersion(src, sets);
 	obs_data_release(sets);
 
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(version));
 	AUTO_DEBUG;
 }
 
@@ -44,6 +44,8 @@ namespace osn
 
 		static void initialize_global_signals();
 		static void finalize_global_signals();
+		static void initialize_type_info();
+		static void finalize_type_info();
 		static void global_source_create_cb(void* ptr, calldata_t* cd);
 		static void global_source_destroy_cb(void* ptr, calldata_t* cd);
 
@@ -87,11 +89,21 @@ namespace osn
 		    const int64_t                  id,
 		    const std::vector<ipc::value>& args,
 		    std::vector<ipc::value>&       rval);
+		static void GetListItems(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
 		static void GetSettings(
 		    void*                          data,
 		    const int64_t                  id,
 		    const std::vector<ipc::value>& args,
 		    std::vector<ipc::value>&       rval);
+		static void GetSettingsBinary(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
 		static void
 		    Update(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval);
 		static void
@@ -21,6 +21,7 @@
 #include <memory>
 #include <obs.h>
 #include "error.hpp"
+#include "osn-batch.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
 
@@ -52,6 +53,7 @@ void osn::Transition::Register(ipc::server& srv)
 	cls->register_function(std::make_shared<ipc::function>(
 	    "Start", std::vector<ipc::type>{ipc::type::UInt64, ipc::type::UInt32, ipc::type::UInt64}, Start));
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
 }
 
 void osn::Transition::Types(
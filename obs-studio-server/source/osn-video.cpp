@@ -19,9 +19,15 @@
 #include "osn-video.hpp"
 #include <ipc-server.hpp>
 #include <obs.h>
+#include <shared_mutex>
 #include "error.hpp"
+#include "osn-batch.hpp"
+#include "osn-callstats.hpp"
 #include "shared.hpp"
 
+// Held shared while reading from the video output, exclusively while it is replaced.
+static std::shared_mutex video_mtx;
+
 void osn::Video::Register(ipc::server& srv)
 {
 	std::shared_ptr<ipc::collection> cls = std::make_shared<ipc::collection>("Video");
@@ -29,7 +35,33 @@ void osn::Video::Register(ipc::server& srv)
 	    "GetSkippedFrames", std::vector<ipc::type>{}, GetSkippedFrames));
 	cls->register_function(
 	    std::make_shared<ipc::function>("GetTotalFrames", std::vector<ipc::type>{}, GetTotalFrames));
+	osn::CallStats::DeclareConcurrent(cls, {"GetSkippedFrames", "GetTotalFrames"});
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
+}
+
+int osn::Video::Reset(obs_video_info* ovi)
+{
+	std::unique_lock<std::shared_mutex> ul(video_mtx);
+	return obs_reset_video(ovi);
+}
+
+void osn::Video::Shutdown()
+{
+	std::unique_lock<std::shared_mutex> ul(video_mtx);
+	obs_shutdown();
+}
+
+uint32_t osn::Video::LaggedFrames()
+{
+	std::shared_lock<std::shared_mutex> sl(video_mtx);
+	return obs_get_lagged_frames();
+}
+
+uint32_t osn::Video::TotalFrames()
+{
+	std::shared_lock<std::shared_mutex> sl(video_mtx);
+	return obs_get_total_frames();
 }
 
 void osn::Video::GetSkippedFrames(
@@ -38,6 +70,7 @@ void osn::Video::GetSkippedFrames(
     const std::vector<ipc::value>& args,
     std::vector<ipc::value>&       rval)
 {
+	std::shared_lock<std::shared_mutex> sl(video_mtx);
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 	rval.push_back(ipc::value(video_output_get_skipped_frames(obs_get_video())));
 	AUTO_DEBUG;
@@ -49,6 +82,7 @@ void osn::Video::GetTotalFrames(
     const std::vector<ipc::value>& args,
     std::vector<ipc::value>&       rval)
 {
+	std::shared_lock<std::shared_mutex> sl(video_mtx);
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 	rval.push_back(ipc::value(video_output_get_total_frames(obs_get_video())));
 	AUTO_DEBUG;
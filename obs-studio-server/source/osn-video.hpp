@@ -28,6 +28,15 @@ namespace osn
 		public:
 		static void Register(ipc::server&);
 
+		// The frame counters are read concurrently with other calls, so every
+		//  reset and the final shutdown of the video output must go through these.
+		static int  Reset(obs_video_info* ovi);
+		static void Shutdown();
+
+		// Render counters for Global, read under the same lock.
+		static uint32_t LaggedFrames();
+		static uint32_t TotalFrames();
+
 		static void GetSkippedFrames(
 		    void*                          data,
 		    const int64_t                  id,
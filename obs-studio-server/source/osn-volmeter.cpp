@@ -17,12 +17,27 @@
 ******************************************************************************/
 
 #include "osn-volmeter.hpp"
+#include <new>
+#include <string>
 #include "error.hpp"
+#include "obs-volmeter-levels.hpp"
 #include "obs.h"
+#include "osn-batch.hpp"
+#include "osn-callstats.hpp"
 #include "osn-source.hpp"
 #include "shared.hpp"
+#include "util-float-array.hpp"
 #include "utility.hpp"
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+util::shared_memory osn::VolMeter::shared_levels;
+bool                osn::VolMeter::shared_levels_valid = false;
+
 osn::VolMeter::Manager& osn::VolMeter::Manager::GetInstance()
 {
 	static Manager _inst;
@@ -34,13 +49,32 @@ osn::VolMeter::VolMeter(obs_fader_type type)
 	self = obs_volmeter_create(type);
 	if (!self)
 		throw std::exception();
+	slot = &local_slot;
 }
 
 osn::VolMeter::~VolMeter()
 {
+	// The shared slot was released when the meter was freed, it may belong to
+	//  a new meter by the time the last reference goes away.
 	obs_volmeter_destroy(self);
 }
 
+void osn::VolMeter::release_slot()
+{
+	obs::VolMeterSharedSlot* current = slot.load(std::memory_order_acquire);
+	if (current != &local_slot) {
+		// Readers stop trusting its content once the id no longer matches.
+		current->write(UINT64_MAX, 0, local_slot.magnitude, local_slot.peak, local_slot.input_peak);
+	}
+}
+
+bool osn::VolMeter::read_levels(obs::VolMeterLevels& levels, uint32_t& seq)
+{
+	// Loaded once, then only trusted if the slot still holds this meter's levels.
+	obs::VolMeterSharedSlot* current = slot.load(std::memory_order_acquire);
+	return current->read(levels, seq) && (levels.id == id);
+}
+
 void osn::VolMeter::Register(ipc::server& srv)
 {
 	std::shared_ptr<ipc::collection> cls = std::make_shared<ipc::collection>("VolMeter");
@@ -60,7 +94,34 @@ void osn::VolMeter::Register(ipc::server& srv)
 	cls->register_function(
 	    std::make_shared<ipc::function>("RemoveCallback", std::vector<ipc::type>{ipc::type::UInt64}, RemoveCallback));
 	cls->register_function(std::make_shared<ipc::function>("Query", std::vector<ipc::type>{ipc::type::UInt64}, Query));
+	cls->register_function(
+	    std::make_shared<ipc::function>("GetSharedLevels", std::vector<ipc::type>{}, GetSharedLevels));
+	cls->register_function(std::make_shared<ipc::function>("QueryAll", std::vector<ipc::type>{}, QueryAll));
+	cls->register_function(std::make_shared<ipc::function>("QueryEvents", std::vector<ipc::type>{}, QueryEvents));
+	osn::CallStats::DeclareConcurrent(cls, {"Query", "QueryAll", "QueryEvents", "GetSharedLevels"});
 	srv.register_collection(cls);
+	osn::Batch::Track(cls);
+
+	// Map the shared level region, meters fall back to IPC if this fails.
+#if defined(_WIN32)
+	uint64_t pid = GetCurrentProcessId();
+#else
+	uint64_t pid = getpid();
+#endif
+	std::string name = "obs-studio-node-volmeter-" + std::to_string(pid);
+	shared_levels_valid = shared_levels.create(name, obs::VolMeterSharedSize());
+	if (shared_levels_valid) {
+		auto header        = new (shared_levels.data()) obs::VolMeterSharedHeader();
+		header->magic      = obs::VolMeterSharedMagic;
+		header->version    = obs::VolMeterSharedVersion;
+		header->slot_count = obs::VolMeterSharedSlotCount;
+		header->slot_size  = sizeof(obs::VolMeterSharedSlot);
+
+		obs::VolMeterSharedSlot* slots = obs::VolMeterSharedSlots(shared_levels.data());
+		for (uint32_t idx = 0; idx < obs::VolMeterSharedSlotCount; idx++) {
+			new (&slots[idx]) obs::VolMeterSharedSlot();
+		}
+	}
 }
 
 void osn::VolMeter::ClearVolmeters()
@@ -72,6 +133,7 @@ void osn::VolMeter::ClearVolmeters()
             delete volmeter->id2;
             volmeter->id2 = nullptr;
         }
+        volmeter->release_slot();
     });
 
     Manager::GetInstance().clear();
@@ -104,6 +166,13 @@ void osn::VolMeter::Create(
 		return;
 	}
 
+	uint32_t                 slot_index = obs::VolMeterSharedSlotIndex(meter->id);
+	obs::VolMeterSharedSlot* owned      = &meter->local_slot;
+	if (shared_levels_valid && (slot_index < obs::VolMeterSharedSlotCount))
+		owned = &obs::VolMeterSharedSlots(shared_levels.data())[slot_index];
+	owned->write(meter->id, 0, meter->local_slot.magnitude, meter->local_slot.peak, meter->local_slot.input_peak);
+	meter->slot.store(owned, std::memory_order_release);
+
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 	rval.push_back(ipc::value(meter->id));
 	rval.push_back(ipc::value(obs_volmeter_get_update_interval(meter->self)));
@@ -126,13 +195,17 @@ void osn::VolMeter::Destroy(
 		return;
 	}
 
-	Manager::GetInstance().free(uid);
 	if (meter->id2) { // Ensure there are no more callbacks
 		obs_volmeter_remove_callback(meter->self, OBSCallback, meter->id2);
 		delete meter->id2;
 		meter->id2 = nullptr;
 	}
 
+	// The id and its shared slot may be reused as soon as the meter is freed,
+	//  so release the slot first while no callback can write to it anymore.
+	meter->release_slot();
+	Manager::GetInstance().free(uid);
+
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
 	AUTO_DEBUG;
 }
@@ -262,7 +335,7 @@ void osn::VolMeter::AddCallback(
 	}
 
 	rval.push_back(ipc::value(uint64_t(ErrorCode::Ok)));
-	rval.push_back(ipc::value(meter->callback_count));
+	rval.push_back(ipc::value(meter->callback_count.load()));
 	AUTO_DEBUG;
 }
 
@@ -289,7 +362,7 @@ void osn::VolMeter::RemoveCallback(
 	}
 
 	rval.push_back(ipc::value(uint64_t(ErrorCode::Ok)));
-	rval.push_back(ipc::value(meter->callback_count));
+	rval.push_back(ipc::value(meter->callback_count.load()));
 	AUTO_DEBUG;
 }
 
@@ -308,20 +381,107 @@ void osn::VolMeter::Query(
 		return;
 	}
 
+	obs::VolMeterLevels levels;
+	uint32_t            seq;
+	if (!meter->read_levels(levels, seq)) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::Error));
+		rval.push_back(ipc::value("Meter data is being updated."));
+		AUTO_DEBUG;
+		return;
+	}
+
 	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(int32_t(levels.magnitude.size())));
+	rval.push_back(ipc::value(util::float_array::pack(levels.magnitude)));
+	rval.push_back(ipc::value(util::float_array::pack(levels.peak)));
+	rval.push_back(ipc::value(util::float_array::pack(levels.input_peak)));
+	AUTO_DEBUG;
+}
 
-	std::unique_lock<std::mutex> ulock(meter->current_data_mtx);
+void osn::VolMeter::GetSharedLevels(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	if (!shared_levels_valid) {
+		rval.push_back(ipc::value((uint64_t)ErrorCode::NotFound));
+		rval.push_back(ipc::value("Shared memory for meters is not available."));
+		AUTO_DEBUG;
+		return;
+	}
 
-	rval.push_back(ipc::value(meter->current_data.ch));
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(shared_levels.name()));
+	rval.push_back(ipc::value(obs::VolMeterSharedSlotCount));
+	AUTO_DEBUG;
+}
 
-	for (size_t ch = 0; ch < meter->current_data.ch; ch++) {
-		rval.push_back(ipc::value(meter->current_data.magnitude[ch]));
-		rval.push_back(ipc::value(meter->current_data.peak[ch]));
-		rval.push_back(ipc::value(meter->current_data.input_peak[ch]));
-	}
+void osn::VolMeter::QueryAll(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	std::vector<char> buf;
+	uint32_t          count = 0;
+
+	Manager::GetInstance().for_each([&buf, &count](const std::shared_ptr<osn::VolMeter>& meter) {
+		obs::VolMeterLevels levels;
+		uint32_t            seq;
+		if ((meter->callback_count == 0) || !meter->read_levels(levels, seq)) {
+			return;
+		}
+
+		obs::VolMeterLevels::write(
+		    buf,
+		    meter->id,
+		    uint32_t(levels.magnitude.size()),
+		    levels.magnitude.data(),
+		    levels.peak.data(),
+		    levels.input_peak.data());
+		count++;
+	});
 
-	ulock.unlock();
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(count));
+	rval.push_back(ipc::value(buf));
+	AUTO_DEBUG;
+}
+
+void osn::VolMeter::QueryEvents(
+    void*                          data,
+    const int64_t                  id,
+    const std::vector<ipc::value>& args,
+    std::vector<ipc::value>&       rval)
+{
+	std::vector<char> buf;
+	uint32_t          count = 0;
+
+	// A meter has an event pending whenever its slot was written since the last call.
+	Manager::GetInstance().for_each([&buf, &count](std::shared_ptr<osn::VolMeter>& meter) {
+		obs::VolMeterLevels levels;
+		uint32_t            seq;
+		if ((meter->callback_count == 0) || !meter->read_levels(levels, seq)) {
+			return;
+		}
+		if (meter->last_sequence.exchange(seq) == seq) {
+			return;
+		}
+
+		obs::VolMeterLevels::write(
+		    buf,
+		    meter->id,
+		    uint32_t(levels.magnitude.size()),
+		    levels.magnitude.data(),
+		    levels.peak.data(),
+		    levels.input_peak.data());
+		count++;
+	});
 
+	rval.push_back(ipc::value((uint64_t)ErrorCode::Ok));
+	rval.push_back(ipc::value(count));
+	rval.push_back(ipc::value(buf));
 	AUTO_DEBUG;
 }
 
@@ -337,16 +497,19 @@ void osn::VolMeter::OBSCallback(
 	}
 
 #define MAKE_FLOAT_SANE(db) (std::isfinite(db) ? db : (db > 0 ? 0.0f : -65535.0f))
-#define PREVIOUS_FRAME_WEIGHT
-
-	std::unique_lock<std::mutex> ulock(meter->current_data_mtx);
 
-	meter->current_data.ch = obs_volmeter_get_nr_channels(meter->self);
+	float l_magnitude[MAX_AUDIO_CHANNELS];
+	float l_peak[MAX_AUDIO_CHANNELS];
+	float l_input_peak[MAX_AUDIO_CHANNELS];
 	for (size_t ch = 0; ch < MAX_AUDIO_CHANNELS; ch++) {
-		meter->current_data.magnitude[ch]  = MAKE_FLOAT_SANE(magnitude[ch]);
-		meter->current_data.peak[ch]       = MAKE_FLOAT_SANE(peak[ch]);
-		meter->current_data.input_peak[ch] = MAKE_FLOAT_SANE(input_peak[ch]);
+		l_magnitude[ch]  = MAKE_FLOAT_SANE(magnitude[ch]);
+		l_peak[ch]       = MAKE_FLOAT_SANE(peak[ch]);
+		l_input_peak[ch] = MAKE_FLOAT_SANE(input_peak[ch]);
 	}
 
 #undef MAKE_FLOAT_SANE
+
+	// Lock-free publish, neither IPC nor shared memory readers can stall the audio thread.
+	meter->slot.load(std::memory_order_acquire)
+	    ->write(meter->id, obs_volmeter_get_nr_channels(meter->self), l_magnitude, l_peak, l_input_peak);
 }
@@ -17,10 +17,14 @@
 ******************************************************************************/
 
 #pragma once
+#include <atomic>
 #include <ipc-server.hpp>
 #include <memory>
 #include <queue>
+#include <vector>
+#include "obs-volmeter-levels.hpp"
 #include "obs.h"
+#include "util-shared-memory.hpp"
 #include "utility.hpp"
 
 namespace osn
@@ -45,21 +49,26 @@ namespace osn
 		};
 
 		private:
-		obs_volmeter_t* self;
-		uint64_t        id;
-		size_t          callback_count = 0;
-		uint64_t*       id2            = nullptr;
-
-		struct AudioData
-		{
-			float   magnitude[MAX_AUDIO_CHANNELS]  = {0};
-			float   peak[MAX_AUDIO_CHANNELS]       = {0};
-			float   input_peak[MAX_AUDIO_CHANNELS] = {0};
-			int32_t ch                             = 0;
-		};
-
-		AudioData current_data;
-		std::mutex                 current_data_mtx;
+		obs_volmeter_t*     self;
+		uint64_t            id;
+		std::atomic<size_t> callback_count = {0};
+		uint64_t*           id2            = nullptr;
+
+		// Levels are published through a seqlock slot, either inside the shared
+		//  memory region or, if that is unavailable, inside the meter itself. The
+		//  slot is set once in Create and kept for the meter's lifetime, concurrent
+		//  readers must check the id they read against the meter id.
+		std::atomic<obs::VolMeterSharedSlot*> slot = {nullptr};
+		obs::VolMeterSharedSlot               local_slot;
+		std::atomic<uint32_t>                 last_sequence = {0};
+
+		// Hands the shared slot back once no callback can write to it anymore.
+		void release_slot();
+		// Reads this meter's levels, fails if the slot is mid-update or was released.
+		bool read_levels(obs::VolMeterLevels& levels, uint32_t& seq);
+
+		static util::shared_memory shared_levels;
+		static bool                shared_levels_valid;
 
 		public:
 		VolMeter(obs_fader_type type);
@@ -102,6 +111,18 @@ namespace osn
 
 		static void
 		            Query(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval);
+		static void GetSharedLevels(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
+		static void
+		    QueryAll(void* data, const int64_t id, const std::vector<ipc::value>& args, std::vector<ipc::value>& rval);
+		static void QueryEvents(
+		    void*                          data,
+		    const int64_t                  id,
+		    const std::vector<ipc::value>& args,
+		    std::vector<ipc::value>&       rval);
 		static void OBSCallback(
 		    void*       param,
 		    const float magnitude[MAX_AUDIO_CHANNELS],
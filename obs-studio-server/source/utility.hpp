@@ -19,9 +19,11 @@
 #pragma once
 #include <functional>
 #include <limits>
-#include <list>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #define FORCE_INLINE __forceinline
@@ -32,11 +34,15 @@
 
 namespace utility
 {
+	// Generational handle allocator backed by a slot table.
+	//  A handle holds the slot index in the lower 32 bits and the generation of
+	//  the slot in the upper 32 bits. Freeing a handle bumps the generation of
+	//  its slot, so handles to destroyed objects are never valid again even if
+	//  the slot gets reused. Allocation and free are O(1).
 	class unique_id
 	{
 		public:
-		typedef uint64_t              id_t;
-		typedef std::pair<id_t, id_t> range_t;
+		typedef uint64_t id_t;
 
 		public:
 		unique_id();
@@ -48,23 +54,40 @@ namespace utility
 		bool is_allocated(id_t);
 		id_t count(bool count_free);
 
-		protected:
-		bool mark_used(id_t);
-		void mark_used_range(id_t, id_t);
-		bool mark_free(id_t);
-		void mark_free_range(id_t, id_t);
+		static inline id_t make(uint32_t index, uint32_t generation)
+		{
+			return (id_t(generation) << 32) | id_t(index);
+		}
+		static inline uint32_t index(id_t v)
+		{
+			return uint32_t(v & 0xFFFFFFFFull);
+		}
+		static inline uint32_t generation(id_t v)
+		{
+			return uint32_t(v >> 32);
+		}
 
 		private:
-		std::list<range_t> allocated;
+		struct slot_t
+		{
+			uint32_t generation = 0;
+			uint32_t next_free  = std::numeric_limits<uint32_t>::max();
+			bool     used       = false;
+		};
+
+		std::vector<slot_t> slots;
+		uint32_t            free_head = std::numeric_limits<uint32_t>::max();
+		id_t                used      = 0;
 	};
 
 	template<typename T>
 	class unique_object_manager
 	{
 		protected:
-		utility::unique_id                     id_generator;
-		std::map<utility::unique_id::id_t, T*> object_map;
-		std::recursive_mutex                   internal_mutex;
+		utility::unique_id                               id_generator;
+		std::map<utility::unique_id::id_t, T*>           object_map;
+		std::unordered_map<T*, utility::unique_id::id_t> reverse_map;
+		std::shared_mutex                                internal_mutex;
 
 		public:
 		unique_object_manager() {}
@@ -75,30 +98,30 @@ namespace utility
 
 		utility::unique_id::id_t allocate(T* obj)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
 
 			utility::unique_id::id_t uid = id_generator.allocate();
 			if (uid == std::numeric_limits<utility::unique_id::id_t>::max()) {
 				return uid;
 			}
 			object_map.insert_or_assign(uid, obj);
+			reverse_map.insert_or_assign(obj, uid);
 			return uid;
 		}
 
 		utility::unique_id::id_t find(T* obj)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::shared_lock<std::shared_mutex> lock(internal_mutex);
 
-			for (auto kv : object_map) {
-				if (kv.second == obj) {
-					return kv.first;
-				}
+			auto iter = reverse_map.find(obj);
+			if (iter != reverse_map.end()) {
+				return iter->second;
 			}
 			return std::numeric_limits<utility::unique_id::id_t>::max();
 		}
 		T* find(utility::unique_id::id_t id)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::shared_lock<std::shared_mutex> lock(internal_mutex);
 
 			auto iter = object_map.find(id);
 			if (iter != object_map.end()) {
@@ -109,21 +132,21 @@ namespace utility
 
 		utility::unique_id::id_t free(T* obj)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
 
-			utility::unique_id::id_t uid = std::numeric_limits<utility::unique_id::id_t>::max();
-			for (auto kv : object_map) {
-				if (kv.second == obj) {
-					uid = kv.first;
-					object_map.erase(kv.first);
-					break;
-				}
+			auto iter = reverse_map.find(obj);
+			if (iter == reverse_map.end()) {
+				return std::numeric_limits<utility::unique_id::id_t>::max();
 			}
+			utility::unique_id::id_t uid = iter->second;
+			reverse_map.erase(iter);
+			object_map.erase(uid);
+			id_generator.free(uid);
 			return uid;
 		}
 		T* free(utility::unique_id::id_t id)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
 
 			auto iter = object_map.find(id);
 			if (iter == object_map.end()) {
@@ -131,29 +154,48 @@ namespace utility
 			}
 			T* obj = iter->second;
 			object_map.erase(iter);
+			id_generator.free(id);
+
+			auto rev = reverse_map.find(obj);
+			if ((rev != reverse_map.end()) && (rev->second == id)) {
+				reverse_map.erase(rev);
+			}
 			return obj;
 		}
 
-        void for_each(std::function<void(T*)> for_each_method)
-        {
-            for (auto it = object_map.begin(); it != object_map.end(); ++it) {
-                for_each_method(it->second);
-            }
-        }
+		// Runs on a snapshot taken under the read lock, so the callback may
+		//  use the manager and does not block lookups from other threads.
+		void for_each(std::function<void(T*)> for_each_method)
+		{
+			std::vector<T*> snapshot;
+			{
+				std::shared_lock<std::shared_mutex> lock(internal_mutex);
+				snapshot.reserve(object_map.size());
+				for (auto it = object_map.begin(); it != object_map.end(); ++it) {
+					snapshot.push_back(it->second);
+				}
+			}
+			for (auto& obj : snapshot) {
+				for_each_method(obj);
+			}
+		}
 
-        void clear()
-        {
-            object_map.clear();
-        }
+		void clear()
+		{
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
+			object_map.clear();
+			reverse_map.clear();
+		}
 	};
 
 	template<typename T>
 	class generic_object_manager
 	{
 		protected:
-		utility::unique_id                    id_generator;
-		std::map<utility::unique_id::id_t, T> object_map;
-		std::recursive_mutex                  internal_mutex;
+		utility::unique_id                              id_generator;
+		std::map<utility::unique_id::id_t, T>           object_map;
+		std::unordered_map<T, utility::unique_id::id_t> reverse_map;
+		std::shared_mutex                               internal_mutex;
 
 		public:
 		generic_object_manager() {}
@@ -164,30 +206,30 @@ namespace utility
 
 		utility::unique_id::id_t allocate(T obj)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
 
 			utility::unique_id::id_t uid = id_generator.allocate();
 			if (uid == std::numeric_limits<utility::unique_id::id_t>::max()) {
 				return uid;
 			}
 			object_map.insert_or_assign(uid, obj);
+			reverse_map.insert_or_assign(obj, uid);
 			return uid;
 		}
 
 		utility::unique_id::id_t find(T obj)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::shared_lock<std::shared_mutex> lock(internal_mutex);
 
-			for (auto kv : object_map) {
-				if (kv.second == obj) {
-					return kv.first;
-				}
+			auto iter = reverse_map.find(obj);
+			if (iter != reverse_map.end()) {
+				return iter->second;
 			}
 			return std::numeric_limits<utility::unique_id::id_t>::max();
 		}
 		T find(utility::unique_id::id_t id)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::shared_lock<std::shared_mutex> lock(internal_mutex);
 
 			auto iter = object_map.find(id);
 			if (iter != object_map.end()) {
@@ -198,21 +240,21 @@ namespace utility
 
 		utility::unique_id::id_t free(T obj)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
 
-			utility::unique_id::id_t uid = std::numeric_limits<utility::unique_id::id_t>::max();
-			for (auto kv : object_map) {
-				if (kv.second == obj) {
-					uid = kv.first;
-					object_map.erase(kv.first);
-					break;
-				}
+			auto iter = reverse_map.find(obj);
+			if (iter == reverse_map.end()) {
+				return std::numeric_limits<utility::unique_id::id_t>::max();
 			}
+			utility::unique_id::id_t uid = iter->second;
+			reverse_map.erase(iter);
+			object_map.erase(uid);
+			id_generator.free(uid);
 			return uid;
 		}
 		T free(utility::unique_id::id_t id)
 		{
-			std::lock_guard<std::recursive_mutex> lock(internal_mutex);
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
 
 			auto iter = object_map.find(id);
 			if (iter == object_map.end()) {
@@ -220,19 +262,37 @@ namespace utility
 			}
 			T obj = iter->second;
 			object_map.erase(iter);
+			id_generator.free(id);
+
+			auto rev = reverse_map.find(obj);
+			if ((rev != reverse_map.end()) && (rev->second == id)) {
+				reverse_map.erase(rev);
+			}
 			return obj;
 		}
 
-        void for_each(std::function<void(T&)> for_each_method)
-        {
-            for (auto it = object_map.begin(); it != object_map.end(); ++it) {
-                for_each_method(it->second);
-            }
-        }
+		// Runs on a snapshot taken under the read lock, so the callback may
+		//  use the manager and does not block lookups from other threads.
+		void for_each(std::function<void(T&)> for_each_method)
+		{
+			std::vector<T> snapshot;
+			{
+				std::shared_lock<std::shared_mutex> lock(internal_mutex);
+				snapshot.reserve(object_map.size());
+				for (auto it = object_map.begin(); it != object_map.end(); ++it) {
+					snapshot.push_back(it->second);
+				}
+			}
+			for (auto& obj : snapshot) {
+				for_each_method(obj);
+			}
+		}
 
-        void clear()
-        {
-            object_map.clear();
-        }
+		void clear()
+		{
+			std::unique_lock<std::shared_mutex> lock(internal_mutex);
+			object_map.clear();
+			reverse_map.clear();
+		}
 	};
 } // namespace utility
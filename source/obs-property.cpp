@@ -20,10 +20,19 @@
 
 std::shared_ptr<obs::Property> obs::Property::deserialize(std::vector<char> const& buf)
 {
-	obs::Property::Type type = (Type)buf[0];
+	BufferReader reader(buf.data(), buf.size());
+	return deserialize(reader);
+}
+
+std::shared_ptr<obs::Property> obs::Property::deserialize(BufferReader& buf)
+{
+	uint8_t type = 0;
+	if (!buf.read(type)) {
+		return nullptr;
+	}
 
 	std::shared_ptr<Property> prop;
-	switch (type) {
+	switch (Type(type)) {
 	case Type::Invalid:
 		return nullptr;
 		break;
@@ -70,6 +79,12 @@ std::shared_ptr<obs::Property> obs::Property::deserialize(std::vector<char> cons
 	return prop;
 }
 
+bool obs::Property::serialize(std::vector<char>& buf)
+{
+	BufferWriter writer(buf.data(), buf.size());
+	return write(writer);
+}
+
 obs::Property::Type obs::Property::type()
 {
 	return Type::Invalid;
@@ -89,72 +104,17 @@ size_t obs::Property::size()
 	return total;
 }
 
-bool obs::Property::serialize(std::vector<char>& buf)
+bool obs::Property::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	size_t offset = 0;
-	buf[offset]   = uint8_t(type());
-	offset++;
-
-	reinterpret_cast<size_t&>(buf[offset]) = name.size();
-	offset += sizeof(size_t);
-	std::memcpy(&buf[offset], name.data(), name.size());
-	offset += name.size();
-
-	reinterpret_cast<size_t&>(buf[offset]) = description.size();
-	offset += sizeof(size_t);
-	std::memcpy(&buf[offset], description.data(), description.size());
-	offset += description.size();
-
-	reinterpret_cast<size_t&>(buf[offset]) = long_description.size();
-	offset += sizeof(size_t);
-	std::memcpy(&buf[offset], long_description.data(), long_description.size());
-	offset += long_description.size();
-
-	buf[offset] = enabled;
-	offset++;
-	buf[offset] = visible;
-	offset++;
-
-	return true;
+	return buf.write(uint8_t(type())) && buf.write(name) && buf.write(description) && buf.write(long_description)
+	       && buf.write(enabled) && buf.write(visible);
 }
 
-bool obs::Property::read(std::vector<char> const& buf)
+bool obs::Property::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	size_t offset = 0;
-
-	size_t length = 0;
-
-	/* Type is already read by deserialize(). */ offset += 1;
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	name = std::string(&buf[offset], length);
-	offset += length;
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	description = std::string(&buf[offset], length);
-	offset += length;
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	long_description = std::string(&buf[offset], length);
-	offset += length;
-
-	enabled = !!buf[offset];
-	offset += sizeof(uint8_t);
-	visible = !!buf[offset];
-	offset += sizeof(uint8_t);
-
-	return true;
+	/* Type is already read by deserialize(). */
+	return buf.read(name) && buf.read(description) && buf.read(long_description) && buf.read(enabled)
+	       && buf.read(visible);
 }
 
 obs::Property::Type obs::BooleanProperty::type()
@@ -167,14 +127,14 @@ size_t obs::BooleanProperty::size()
 	return Property::size();
 }
 
-bool obs::BooleanProperty::read(std::vector<char> const& buf)
+bool obs::BooleanProperty::read(BufferReader& buf)
 {
 	return Property::read(buf);
 }
 
-bool obs::BooleanProperty::serialize(std::vector<char>& buf)
+bool obs::BooleanProperty::write(BufferWriter& buf)
 {
-	return Property::serialize(buf);
+	return Property::write(buf);
 }
 
 size_t obs::NumberProperty::size()
@@ -184,35 +144,18 @@ size_t obs::NumberProperty::size()
 	return total;
 }
 
-bool obs::NumberProperty::serialize(std::vector<char>& buf)
+bool obs::NumberProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset = Property::size();
-	buf[offset]   = uint8_t(field_type);
-
-	return true;
+	return Property::write(buf) && buf.write(uint8_t(field_type));
 }
 
-bool obs::NumberProperty::read(std::vector<char> const& buf)
+bool obs::NumberProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::read(buf)) {
+	uint8_t value = 0;
+	if (!Property::read(buf) || !buf.read(value)) {
 		return false;
 	}
-
-	size_t offset = Property::size();
-	field_type    = NumberType(buf[offset]);
-
+	field_type = NumberType(value);
 	return true;
 }
 
@@ -228,46 +171,14 @@ size_t obs::IntegerProperty::size()
 	return total;
 }
 
-bool obs::IntegerProperty::serialize(std::vector<char>& buf)
+bool obs::IntegerProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!NumberProperty::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset                             = NumberProperty::size();
-	*reinterpret_cast<int64_t*>(&buf[offset]) = minimum;
-	offset += sizeof(int64_t);
-	*reinterpret_cast<int64_t*>(&buf[offset]) = maximum;
-	offset += sizeof(int64_t);
-	*reinterpret_cast<int64_t*>(&buf[offset]) = step;
-	offset += sizeof(int64_t);
-
-	return true;
+	return NumberProperty::write(buf) && buf.write(minimum) && buf.write(maximum) && buf.write(step);
 }
 
-bool obs::IntegerProperty::read(std::vector<char> const& buf)
+bool obs::IntegerProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!NumberProperty::read(buf)) {
-		return false;
-	}
-
-	size_t offset = NumberProperty::size();
-	minimum       = *reinterpret_cast<const int64_t*>(&buf[offset]);
-	offset += sizeof(int64_t);
-	maximum = *reinterpret_cast<const int64_t*>(&buf[offset]);
-	offset += sizeof(int64_t);
-	step = *reinterpret_cast<const int64_t*>(&buf[offset]);
-	offset += sizeof(int64_t);
-
-	return true;
+	return NumberProperty::read(buf) && buf.read(minimum) && buf.read(maximum) && buf.read(step);
 }
 
 obs::Property::Type obs::FloatProperty::type()
@@ -282,46 +193,14 @@ size_t obs::FloatProperty::size()
 	return total;
 }
 
-bool obs::FloatProperty::serialize(std::vector<char>& buf)
+bool obs::FloatProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!NumberProperty::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset                              = NumberProperty::size();
-	*reinterpret_cast<double_t*>(&buf[offset]) = minimum;
-	offset += sizeof(double_t);
-	*reinterpret_cast<double_t*>(&buf[offset]) = maximum;
-	offset += sizeof(double_t);
-	*reinterpret_cast<double_t*>(&buf[offset]) = step;
-	offset += sizeof(double_t);
-
-	return true;
+	return NumberProperty::write(buf) && buf.write(minimum) && buf.write(maximum) && buf.write(step);
 }
 
-bool obs::FloatProperty::read(std::vector<char> const& buf)
+bool obs::FloatProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!NumberProperty::read(buf)) {
-		return false;
-	}
-
-	size_t offset = NumberProperty::size();
-	minimum       = *reinterpret_cast<const double_t*>(&buf[offset]);
-	offset += sizeof(double_t);
-	maximum = *reinterpret_cast<const double_t*>(&buf[offset]);
-	offset += sizeof(double_t);
-	step = *reinterpret_cast<const double_t*>(&buf[offset]);
-	offset += sizeof(double_t);
-
-	return true;
+	return NumberProperty::read(buf) && buf.read(minimum) && buf.read(maximum) && buf.read(step);
 }
 
 obs::Property::Type obs::TextProperty::type()
@@ -336,35 +215,18 @@ size_t obs::TextProperty::size()
 	return total;
 }
 
-bool obs::TextProperty::serialize(std::vector<char>& buf)
+bool obs::TextProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset = Property::size();
-	buf[offset]   = uint8_t(field_type);
-
-	return true;
+	return Property::write(buf) && buf.write(uint8_t(field_type));
 }
 
-bool obs::TextProperty::read(std::vector<char> const& buf)
+bool obs::TextProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::read(buf)) {
+	uint8_t value = 0;
+	if (!Property::read(buf) || !buf.read(value)) {
 		return false;
 	}
-
-	size_t offset = Property::size();
-	field_type    = TextType(buf[offset]);
-
+	field_type = TextType(value);
 	return true;
 }
 
@@ -382,68 +244,19 @@ size_t obs::PathProperty::size()
 	return total;
 }
 
-bool obs::PathProperty::serialize(std::vector<char>& buf)
+bool obs::PathProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset = Property::size();
-	buf[offset]   = uint8_t(field_type);
-	offset += sizeof(uint8_t);
-
-	reinterpret_cast<size_t&>(buf[offset]) = filter.size();
-	offset += sizeof(size_t);
-	if (filter.size() > 0) {
-		memcpy(&buf[offset], filter.data(), filter.size());
-		offset += filter.size();
-	}
-
-	reinterpret_cast<size_t&>(buf[offset]) = default_path.size();
-	offset += sizeof(size_t);
-	if (default_path.size() > 0) {
-		memcpy(&buf[offset], default_path.data(), default_path.size());
-		offset += default_path.size();
-	}
-
-	return true;
+	return Property::write(buf) && buf.write(uint8_t(field_type)) && buf.write(filter) && buf.write(default_path);
 }
 
-bool obs::PathProperty::read(std::vector<char> const& buf)
+bool obs::PathProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::read(buf)) {
+	uint8_t value = 0;
+	if (!Property::read(buf) || !buf.read(value)) {
 		return false;
 	}
-
-	size_t length = 0;
-
-	size_t offset = Property::size();
-	field_type    = PathType(buf[offset]);
-	offset += sizeof(uint8_t);
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	if (length > 0) {
-		filter = std::string(&buf[offset], length);
-		offset += length;
-	}
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	if (length > 0) {
-		default_path = std::string(&buf[offset], length);
-		offset += length;
-	}
-
-	return true;
+	field_type = PathType(value);
+	return buf.read(filter) && buf.read(default_path);
 }
 
 obs::Property::Type obs::ListProperty::type()
@@ -457,6 +270,7 @@ size_t obs::ListProperty::size()
 	total += sizeof(uint8_t);
 	total += sizeof(uint8_t);
 	total += sizeof(size_t);
+	total += sizeof(size_t);
 	for (auto& entry : items) {
 		total += sizeof(size_t);
 		total += entry.name.size();
@@ -477,49 +291,29 @@ size_t obs::ListProperty::size()
 	return total;
 }
 
-bool obs::ListProperty::serialize(std::vector<char>& buf)
+bool obs::ListProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::serialize(buf)) {
+	if (!Property::write(buf) || !buf.write(uint8_t(field_type)) || !buf.write(uint8_t(format))
+	    || !buf.write(item_count) || !buf.write(items.size())) {
 		return false;
 	}
 
-	size_t offset = Property::size();
-	buf[offset]   = uint8_t(field_type);
-	offset += sizeof(uint8_t);
-	buf[offset] = uint8_t(format);
-	offset += sizeof(uint8_t);
-
-	reinterpret_cast<size_t&>(buf[offset]) = items.size();
-	offset += sizeof(size_t);
 	for (auto& entry : items) {
-		reinterpret_cast<size_t&>(buf[offset]) = entry.name.size();
-		offset += sizeof(size_t);
-		if (entry.name.size() > 0) {
-			memcpy(&buf[offset], entry.name.data(), entry.name.size());
-			offset += entry.name.size();
+		if (!buf.write(entry.name) || !buf.write(entry.enabled)) {
+			return false;
 		}
-		buf[offset] = enabled;
-		offset += sizeof(uint8_t);
 		switch (format) {
 		case Format::Integer:
-			reinterpret_cast<int64_t&>(buf[offset]) = entry.value_int;
-			offset += sizeof(int64_t);
+			if (!buf.write(entry.value_int))
+				return false;
 			break;
 		case Format::Float:
-			reinterpret_cast<double_t&>(buf[offset]) = entry.value_float;
-			offset += sizeof(double_t);
+			if (!buf.write(entry.value_float))
+				return false;
 			break;
 		case Format::String:
-			reinterpret_cast<size_t&>(buf[offset]) = entry.value_string.size();
-			offset += sizeof(size_t);
-			if (entry.value_string.size() > 0) {
-				memcpy(&buf[offset], entry.value_string.data(), entry.value_string.size());
-				offset += entry.value_string.size();
-			}
+			if (!buf.write(entry.value_string))
+				return false;
 			break;
 		}
 	}
@@ -527,52 +321,35 @@ bool obs::ListProperty::serialize(std::vector<char>& buf)
 	return true;
 }
 
-bool obs::ListProperty::read(std::vector<char> const& buf)
+bool obs::ListProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::read(buf)) {
+	uint8_t list_type   = 0;
+	uint8_t list_format = 0;
+	size_t  num_entries = 0;
+	if (!Property::read(buf) || !buf.read(list_type) || !buf.read(list_format) || !buf.read(item_count)
+	    || !buf.read(num_entries)) {
 		return false;
 	}
+	field_type = ListType(list_type);
+	format     = Format(list_format);
 
-	size_t offset = Property::size();
-	field_type    = ListType(buf[offset]);
-	offset += sizeof(uint8_t);
-	format = Format(buf[offset]);
-	offset += sizeof(uint8_t);
-
-	size_t num_entries = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
 	for (size_t idx = 0; idx < num_entries; idx++) {
-		size_t length = 0;
-		Item   entry;
-
-		length = reinterpret_cast<const size_t&>(buf[offset]);
-		offset += sizeof(size_t);
-		if (length > 0) {
-			entry.name = std::string(&buf[offset], length);
-			offset += length;
+		Item entry;
+		if (!buf.read(entry.name) || !buf.read(entry.enabled)) {
+			return false;
 		}
-		entry.enabled = !!buf[offset];
-		offset += sizeof(uint8_t);
 		switch (format) {
 		case Format::Integer:
-			entry.value_int = reinterpret_cast<const int64_t&>(buf[offset]);
-			offset += sizeof(int64_t);
+			if (!buf.read(entry.value_int))
+				return false;
 			break;
 		case Format::Float:
-			entry.value_float = reinterpret_cast<const double_t&>(buf[offset]);
-			offset += sizeof(double_t);
+			if (!buf.read(entry.value_float))
+				return false;
 			break;
 		case Format::String:
-			length = reinterpret_cast<const size_t&>(buf[offset]);
-			offset += sizeof(size_t);
-			if (length > 0) {
-				entry.value_string = std::string(&buf[offset], length);
-				offset += length;
-			}
+			if (!buf.read(entry.value_string))
+				return false;
 			break;
 		}
 		items.push_back(std::move(entry));
@@ -591,12 +368,12 @@ size_t obs::ColorProperty::size()
 	return Property::size();
 }
 
-bool obs::ColorProperty::serialize(std::vector<char>& buf)
+bool obs::ColorProperty::write(BufferWriter& buf)
 {
-	return Property::serialize(buf);
+	return Property::write(buf);
 }
 
-bool obs::ColorProperty::read(std::vector<char> const& buf)
+bool obs::ColorProperty::read(BufferReader& buf)
 {
 	return Property::read(buf);
 }
@@ -611,12 +388,12 @@ size_t obs::ButtonProperty::size()
 	return Property::size();
 }
 
-bool obs::ButtonProperty::serialize(std::vector<char>& buf)
+bool obs::ButtonProperty::write(BufferWriter& buf)
 {
-	return Property::serialize(buf);
+	return Property::write(buf);
 }
 
-bool obs::ButtonProperty::read(std::vector<char> const& buf)
+bool obs::ButtonProperty::read(BufferReader& buf)
 {
 	return Property::read(buf);
 }
@@ -631,12 +408,12 @@ size_t obs::FontProperty::size()
 	return Property::size();
 }
 
-bool obs::FontProperty::serialize(std::vector<char>& buf)
+bool obs::FontProperty::write(BufferWriter& buf)
 {
-	return Property::serialize(buf);
+	return Property::write(buf);
 }
 
-bool obs::FontProperty::read(std::vector<char> const& buf)
+bool obs::FontProperty::read(BufferReader& buf)
 {
 	return Property::read(buf);
 }
@@ -655,68 +432,19 @@ size_t obs::EditableListProperty::size()
 	return total;
 }
 
-bool obs::EditableListProperty::serialize(std::vector<char>& buf)
+bool obs::EditableListProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset = Property::size();
-	buf[offset]   = uint8_t(field_type);
-	offset += sizeof(uint8_t);
-
-	reinterpret_cast<size_t&>(buf[offset]) = filter.size();
-	offset += sizeof(size_t);
-	if (filter.size() > 0) {
-		memcpy(&buf[offset], filter.data(), filter.size());
-		offset += filter.size();
-	}
-
-	reinterpret_cast<size_t&>(buf[offset]) = default_path.size();
-	offset += sizeof(size_t);
-	if (default_path.size() > 0) {
-		memcpy(&buf[offset], default_path.data(), default_path.size());
-		offset += default_path.size();
-	}
-
-	return true;
+	return Property::write(buf) && buf.write(uint8_t(field_type)) && buf.write(filter) && buf.write(default_path);
 }
 
-bool obs::EditableListProperty::read(std::vector<char> const& buf)
+bool obs::EditableListProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
+	uint8_t value = 0;
+	if (!Property::read(buf) || !buf.read(value)) {
 		return false;
 	}
-
-	if (!Property::read(buf)) {
-		return false;
-	}
-
-	size_t length = 0;
-
-	size_t offset = Property::size();
-	field_type    = ListType(buf[offset]);
-	offset += sizeof(uint8_t);
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	if (length > 0) {
-		filter = std::string(&buf[offset], length);
-		offset += length;
-	}
-
-	length = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
-	if (length > 0) {
-		default_path = std::string(&buf[offset], length);
-		offset += length;
-	}
-
-	return true;
+	field_type = ListType(value);
+	return buf.read(filter) && buf.read(default_path);
 }
 
 obs::Property::Type obs::FrameRateProperty::type()
@@ -739,95 +467,114 @@ size_t obs::FrameRateProperty::size()
 	return total;
 }
 
-bool obs::FrameRateProperty::serialize(std::vector<char>& buf)
+bool obs::FrameRateProperty::write(BufferWriter& buf)
 {
-	if (buf.size() < size()) {
+	if (!Property::write(buf) || !buf.write(ranges.size())) {
 		return false;
 	}
-
-	if (!Property::serialize(buf)) {
-		return false;
-	}
-
-	size_t offset = Property::size();
-
-	reinterpret_cast<size_t&>(buf[offset]) = ranges.size();
-	offset += sizeof(size_t);
 	for (Range& range : ranges) {
-		reinterpret_cast<uint32_t&>(buf[offset]) = range.minimum.first;
-		offset += sizeof(uint32_t);
-		reinterpret_cast<uint32_t&>(buf[offset]) = range.minimum.second;
-		offset += sizeof(uint32_t);
-		reinterpret_cast<uint32_t&>(buf[offset]) = range.maximum.first;
-		offset += sizeof(uint32_t);
-		reinterpret_cast<uint32_t&>(buf[offset]) = range.maximum.second;
-		offset += sizeof(uint32_t);
+		if (!buf.write(range.minimum.first) || !buf.write(range.minimum.second) || !buf.write(range.maximum.first)
+		    || !buf.write(range.maximum.second)) {
+			return false;
+		}
 	}
 
-	reinterpret_cast<size_t&>(buf[offset]) = options.size();
-	offset += sizeof(size_t);
+	if (!buf.write(options.size())) {
+		return false;
+	}
 	for (Option& option : options) {
-		reinterpret_cast<size_t&>(buf[offset]) = option.name.size();
-		offset += sizeof(size_t);
-		if (option.name.size() > 0) {
-			memcpy(&buf[offset], option.name.data(), option.name.size());
-			offset += option.name.size();
-		}
-		reinterpret_cast<size_t&>(buf[offset]) = option.description.size();
-		offset += sizeof(size_t);
-		if (option.description.size() > 0) {
-			memcpy(&buf[offset], option.description.data(), option.description.size());
-			offset += option.description.size();
+		if (!buf.write(option.name) || !buf.write(option.description)) {
+			return false;
 		}
 	}
 
 	return true;
 }
 
-bool obs::FrameRateProperty::read(std::vector<char> const& buf)
+bool obs::FrameRateProperty::read(BufferReader& buf)
 {
-	if (buf.size() < size()) {
-		return false;
-	}
-
-	if (!Property::read(buf)) {
+	size_t num_ranges = 0;
+	if (!Property::read(buf) || !buf.read(num_ranges)) {
 		return false;
 	}
-
-	size_t length = 0;
-
-	size_t offset     = Property::size();
-	size_t num_ranges = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
 	for (size_t idx = 0; idx < num_ranges; idx++) {
 		Range range;
-		range.minimum.first = reinterpret_cast<const uint32_t&>(buf[offset]);
-		offset += sizeof(uint32_t);
-		range.minimum.second = reinterpret_cast<const uint32_t&>(buf[offset]);
-		offset += sizeof(uint32_t);
-		range.maximum.first = reinterpret_cast<const uint32_t&>(buf[offset]);
-		offset += sizeof(uint32_t);
-		range.maximum.second = reinterpret_cast<const uint32_t&>(buf[offset]);
-		offset += sizeof(uint32_t);
+		if (!buf.read(range.minimum.first) || !buf.read(range.minimum.second) || !buf.read(range.maximum.first)
+		    || !buf.read(range.maximum.second)) {
+			return false;
+		}
 		ranges.push_back(std::move(range));
 	}
 
-	size_t num_options = reinterpret_cast<const size_t&>(buf[offset]);
-	offset += sizeof(size_t);
+	size_t num_options = 0;
+	if (!buf.read(num_options)) {
+		return false;
+	}
 	for (size_t idx = 0; idx < num_options; idx++) {
 		Option option;
-		length = reinterpret_cast<const size_t&>(buf[offset]);
-		offset += sizeof(size_t);
-		if (length > 0) {
-			option.name = std::string(&buf[offset], length);
-		}
-		length = reinterpret_cast<const size_t&>(buf[offset]);
-		offset += sizeof(size_t);
-		if (length > 0) {
-			option.description = std::string(&buf[offset], length);
+		if (!buf.read(option.name) || !buf.read(option.description)) {
+			return false;
 		}
 		options.push_back(std::move(option));
 	}
 
 	return true;
 }
+
+obs::PropertyListWriter::PropertyListWriter(std::vector<char>& buf) : m_buf(buf)
+{
+	m_buf.assign(sizeof(size_t), 0);
+}
+
+bool obs::PropertyListWriter::append(Property& prop)
+{
+	size_t length = prop.size();
+	size_t offset = m_buf.size();
+	m_buf.resize(offset + sizeof(size_t) + length);
+
+	BufferWriter writer(m_buf.data() + offset, sizeof(size_t) + length);
+	if (!writer.write(length) || !prop.write(writer) || (writer.offset() != sizeof(size_t) + length)) {
+		m_buf.resize(offset);
+		return false;
+	}
+
+	// The count in front is kept current, so the buffer is complete after every append.
+	m_count++;
+	std::memcpy(m_buf.data(), &m_count, sizeof(m_count));
+	return true;
+}
+
+obs::PropertyListReader::PropertyListReader(const char* data, size_t size) : m_reader(data, size)
+{
+	m_valid = m_reader.read(m_count);
+}
+
+obs::PropertyListReader::PropertyListReader(std::vector<char> const& buf)
+    : PropertyListReader(buf.data(), buf.size())
+{}
+
+size_t obs::PropertyListReader::count()
+{
+	return m_valid ? m_count : 0;
+}
+
+bool obs::PropertyListReader::next(std::shared_ptr<Property>& prop)
+{
+	prop.reset();
+	if (!m_valid || (m_index >= m_count)) {
+		return false;
+	}
+
+	size_t length = 0;
+	if (!m_reader.read(length) || (m_reader.remaining() < length)) {
+		m_valid = false;
+		return false;
+	}
+
+	// Each property gets a reader limited to its own bytes, so a bad entry can not run into the next one.
+	BufferReader entry(m_reader.current(), length);
+	prop = Property::deserialize(entry);
+	m_reader.skip(length);
+	m_index++;
+	return true;
+}
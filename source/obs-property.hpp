@@ -17,13 +17,120 @@
 ******************************************************************************/
 
 #pragma once
+#include <cmath>
+#include <cstring>
 #include <inttypes.h>
 #include <list>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace obs
 {
+	// Bounds-checked cursor for writing into a property buffer. Nothing in the buffer is
+	//  aligned, so values are always copied in with memcpy.
+	class BufferWriter
+	{
+		char*  m_data;
+		size_t m_size;
+		size_t m_offset = 0;
+
+		public:
+		BufferWriter(char* data, size_t size) : m_data(data), m_size(size) {}
+
+		size_t offset()
+		{
+			return m_offset;
+		}
+
+		template<typename T>
+		bool write(T const& value)
+		{
+			if (m_size - m_offset < sizeof(T))
+				return false;
+			std::memcpy(m_data + m_offset, &value, sizeof(T));
+			m_offset += sizeof(T);
+			return true;
+		}
+
+		bool write(bool const& value)
+		{
+			return write(uint8_t(value ? 1 : 0));
+		}
+
+		bool write(std::string const& value)
+		{
+			if (!write(size_t(value.size())) || (m_size - m_offset < value.size()))
+				return false;
+			std::memcpy(m_data + m_offset, value.data(), value.size());
+			m_offset += value.size();
+			return true;
+		}
+	};
+
+	// Bounds-checked cursor for reading from a property buffer, the counterpart to BufferWriter.
+	class BufferReader
+	{
+		const char* m_data;
+		size_t      m_size;
+		size_t      m_offset = 0;
+
+		public:
+		BufferReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+		size_t offset()
+		{
+			return m_offset;
+		}
+
+		size_t remaining()
+		{
+			return m_size - m_offset;
+		}
+
+		const char* current()
+		{
+			return m_data + m_offset;
+		}
+
+		template<typename T>
+		bool read(T& value)
+		{
+			if (m_size - m_offset < sizeof(T))
+				return false;
+			std::memcpy(&value, m_data + m_offset, sizeof(T));
+			m_offset += sizeof(T);
+			return true;
+		}
+
+		bool read(bool& value)
+		{
+			uint8_t byte = 0;
+			if (!read(byte))
+				return false;
+			value = !!byte;
+			return true;
+		}
+
+		bool read(std::string& value)
+		{
+			size_t length = 0;
+			if (!read(length) || (m_size - m_offset < length))
+				return false;
+			value.assign(m_data + m_offset, length);
+			m_offset += length;
+			return true;
+		}
+
+		bool skip(size_t length)
+		{
+			if (m_size - m_offset < length)
+				return false;
+			m_offset += length;
+			return true;
+		}
+	};
+
 	struct Property
 	{
 		enum class Type : uint8_t
@@ -51,13 +158,16 @@ namespace obs
 		virtual ~Property(){};
 
 		static std::shared_ptr<Property> deserialize(std::vector<char> const& buf);
+		static std::shared_ptr<Property> deserialize(BufferReader& buf);
+
+		bool serialize(std::vector<char>& buf);
 
 		virtual obs::Property::Type type();
 		virtual size_t              size();
-		virtual bool                serialize(std::vector<char>& buf);
+		virtual bool                write(BufferWriter& buf);
 
 		protected:
-		virtual bool read(std::vector<char> const& buf);
+		virtual bool read(BufferReader& buf);
 	};
 
 	struct BooleanProperty : Property
@@ -66,10 +176,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct NumberProperty : Property
@@ -83,10 +193,10 @@ namespace obs
 		virtual ~NumberProperty(){};
 
 		virtual size_t size() override;
-		virtual bool   serialize(std::vector<char>& buf) override;
+		virtual bool   write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct IntegerProperty : NumberProperty
@@ -99,10 +209,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct FloatProperty : NumberProperty
@@ -115,10 +225,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct TextProperty : Property
@@ -135,10 +245,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct PathProperty : Property
@@ -157,10 +267,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct ListProperty : Property
@@ -193,14 +303,18 @@ namespace obs
 		};
 		std::list<Item> items;
 
+		// Number of items the list has in total. Only a page of them may be in items, the rest
+		//  can be fetched on demand with Source.GetListItems.
+		size_t item_count = 0;
+
 		virtual ~ListProperty(){};
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct ColorProperty : Property
@@ -209,10 +323,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct ButtonProperty : Property
@@ -221,10 +335,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct FontProperty : Property
@@ -233,10 +347,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct EditableListProperty : Property
@@ -255,10 +369,10 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
 	};
 
 	struct FrameRateProperty : Property
@@ -281,10 +395,44 @@ namespace obs
 
 		virtual obs::Property::Type type() override;
 		virtual size_t              size() override;
-		virtual bool                serialize(std::vector<char>& buf) override;
+		virtual bool                write(BufferWriter& buf) override;
 
 		protected:
-		virtual bool read(std::vector<char> const& buf) override;
+		virtual bool read(BufferReader& buf) override;
+	};
+
+	// Writes a whole property sheet into one buffer as the properties are built: the number
+	//  of properties, followed by each property prefixed with its length. The caller can fill
+	//  a single property at a time instead of holding the whole sheet.
+	class PropertyListWriter
+	{
+		std::vector<char>& m_buf;
+		size_t             m_count = 0;
+
+		public:
+		PropertyListWriter(std::vector<char>& buf);
+
+		bool append(Property& prop);
+	};
+
+	// Walks a buffer written by PropertyListWriter one property at a time, so the
+	//  caller never has to hold more than the property it is currently converting.
+	class PropertyListReader
+	{
+		BufferReader m_reader;
+		size_t       m_count = 0;
+		size_t       m_index = 0;
+		bool         m_valid = false;
+
+		public:
+		PropertyListReader(const char* data, size_t size);
+		PropertyListReader(std::vector<char> const& buf);
+
+		size_t count();
+
+		// Returns false once every property was read or the buffer turned out to be malformed.
+		//  Properties of an unknown type are skipped and leave prop empty.
+		bool next(std::shared_ptr<Property>& prop);
 	};
 
 } // namespace obs
@@ -0,0 +1,152 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "obs-volmeter-levels.hpp"
+#include <algorithm>
+#include <cstring>
+
+size_t obs::VolMeterLevels::size(uint32_t channels)
+{
+	size_t total = 0;
+	total += sizeof(uint64_t);
+	total += sizeof(uint32_t);
+	total += sizeof(float) * channels * 3;
+	return total;
+}
+
+void obs::VolMeterLevels::write(
+    std::vector<char>& buf,
+    uint64_t           id,
+    uint32_t           channels,
+    const float*       magnitude,
+    const float*       peak,
+    const float*       input_peak)
+{
+	size_t offset = buf.size();
+	buf.resize(offset + size(channels));
+
+	std::memcpy(&buf[offset], &id, sizeof(uint64_t));
+	offset += sizeof(uint64_t);
+	std::memcpy(&buf[offset], &channels, sizeof(uint32_t));
+	offset += sizeof(uint32_t);
+	std::memcpy(&buf[offset], magnitude, sizeof(float) * channels);
+	offset += sizeof(float) * channels;
+	std::memcpy(&buf[offset], peak, sizeof(float) * channels);
+	offset += sizeof(float) * channels;
+	std::memcpy(&buf[offset], input_peak, sizeof(float) * channels);
+	offset += sizeof(float) * channels;
+}
+
+bool obs::VolMeterLevels::read(std::vector<char> const& buf, size_t& offset)
+{
+	if (buf.size() < offset + size(0)) {
+		return false;
+	}
+
+	uint32_t channels = 0;
+	std::memcpy(&id, &buf[offset], sizeof(uint64_t));
+	std::memcpy(&channels, &buf[offset + sizeof(uint64_t)], sizeof(uint32_t));
+	if (buf.size() < offset + size(channels)) {
+		return false;
+	}
+	offset += size(0);
+
+	magnitude.resize(channels);
+	peak.resize(channels);
+	input_peak.resize(channels);
+	if (channels > 0) {
+		std::memcpy(magnitude.data(), &buf[offset], sizeof(float) * channels);
+		offset += sizeof(float) * channels;
+		std::memcpy(peak.data(), &buf[offset], sizeof(float) * channels);
+		offset += sizeof(float) * channels;
+		std::memcpy(input_peak.data(), &buf[offset], sizeof(float) * channels);
+		offset += sizeof(float) * channels;
+	}
+
+	return true;
+}
+
+void obs::VolMeterSharedSlot::write(
+    uint64_t     id,
+    uint32_t     channels,
+    const float* magnitude,
+    const float* peak,
+    const float* input_peak)
+{
+	channels = std::min(channels, VolMeterSharedMaxChannels);
+
+	uint32_t seq = sequence.load(std::memory_order_relaxed);
+	sequence.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	this->id       = id;
+	this->channels = channels;
+	std::memcpy(this->magnitude, magnitude, sizeof(float) * channels);
+	std::memcpy(this->peak, peak, sizeof(float) * channels);
+	std::memcpy(this->input_peak, input_peak, sizeof(float) * channels);
+
+	sequence.store(seq + 2, std::memory_order_release);
+}
+
+bool obs::VolMeterSharedSlot::read(VolMeterLevels& levels, uint32_t& seq)
+{
+	float    l_magnitude[VolMeterSharedMaxChannels];
+	float    l_peak[VolMeterSharedMaxChannels];
+	float    l_input_peak[VolMeterSharedMaxChannels];
+	uint32_t l_channels = 0;
+	uint64_t l_id       = 0;
+
+	// Give up after a few attempts instead of spinning on a writer that died mid-update.
+	for (size_t attempt = 0; attempt < 64; attempt++) {
+		uint32_t seq_begin = sequence.load(std::memory_order_acquire);
+		if (seq_begin & 1) {
+			continue;
+		}
+
+		l_id       = id;
+		l_channels = std::min(channels, VolMeterSharedMaxChannels);
+		std::memcpy(l_magnitude, magnitude, sizeof(float) * l_channels);
+		std::memcpy(l_peak, peak, sizeof(float) * l_channels);
+		std::memcpy(l_input_peak, input_peak, sizeof(float) * l_channels);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (sequence.load(std::memory_order_relaxed) != seq_begin) {
+			continue;
+		}
+
+		levels.id = l_id;
+		levels.magnitude.assign(l_magnitude, l_magnitude + l_channels);
+		levels.peak.assign(l_peak, l_peak + l_channels);
+		levels.input_peak.assign(l_input_peak, l_input_peak + l_channels);
+		seq = seq_begin;
+		return true;
+	}
+
+	return false;
+}
+
+size_t obs::VolMeterSharedSize()
+{
+	return sizeof(VolMeterSharedSlot) + sizeof(VolMeterSharedSlot) * VolMeterSharedSlotCount;
+}
+
+obs::VolMeterSharedSlot* obs::VolMeterSharedSlots(void* base)
+{
+	// The header occupies the first slot-sized block to keep slots aligned.
+	return reinterpret_cast<VolMeterSharedSlot*>(reinterpret_cast<char*>(base) + sizeof(VolMeterSharedSlot));
+}
@@ -0,0 +1,100 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <inttypes.h>
+#include <vector>
+
+namespace obs
+{
+	// Packed level data for any number of volmeters, transported as a single
+	//  ipc::value binary blob instead of three ipc::values per channel.
+	//
+	// Layout per meter: uint64 id, uint32 channels, then 'channels' floats
+	//  each of magnitude, peak and input peak.
+	struct VolMeterLevels
+	{
+		uint64_t           id;
+		std::vector<float> magnitude;
+		std::vector<float> peak;
+		std::vector<float> input_peak;
+
+		static size_t size(uint32_t channels);
+		static void   write(
+		      std::vector<char>& buf,
+		      uint64_t           id,
+		      uint32_t           channels,
+		      const float*       magnitude,
+		      const float*       peak,
+		      const float*       input_peak);
+
+		bool read(std::vector<char> const& buf, size_t& offset);
+	};
+
+	// Shared memory layout for volmeter levels: a header followed by one fixed
+	//  slot per meter id. Each slot is a seqlock: the writer makes the sequence
+	//  odd while updating, readers retry until they see the same even sequence
+	//  before and after copying the data. Neither side ever blocks the other.
+	static const uint32_t VolMeterSharedMagic       = 0x4C4D564F; // 'OVML'
+	static const uint32_t VolMeterSharedVersion     = 1;
+	static const uint32_t VolMeterSharedSlotCount   = 256;
+	static const uint32_t VolMeterSharedMaxChannels = 8;
+
+	struct VolMeterSharedHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t slot_count;
+		uint32_t slot_size;
+	};
+
+	struct alignas(64) VolMeterSharedSlot
+	{
+		std::atomic<uint32_t> sequence{0};
+		uint32_t              channels = 0;
+		uint64_t              id       = UINT64_MAX;
+		float                 magnitude[VolMeterSharedMaxChannels]  = {0};
+		float                 peak[VolMeterSharedMaxChannels]       = {0};
+		float                 input_peak[VolMeterSharedMaxChannels] = {0};
+
+		// Writer side, must only ever be called from one thread at a time.
+		void write(
+		    uint64_t     id,
+		    uint32_t     channels,
+		    const float* magnitude,
+		    const float* peak,
+		    const float* input_peak);
+
+		// Reader side, returns false if no consistent copy could be taken. On
+		//  success 'seq' holds the sequence the copy was taken at.
+		bool read(VolMeterLevels& levels, uint32_t& seq);
+	};
+
+	size_t              VolMeterSharedSize();
+	VolMeterSharedSlot* VolMeterSharedSlots(void* base);
+
+	// Meter ids are server handles with the slot table index in the lower 32
+	//  bits, a meter owns the shared slot with that index if it is in range.
+	//  Readers must compare the slot id with the full meter id.
+	inline uint32_t VolMeterSharedSlotIndex(uint64_t id)
+	{
+		return uint32_t(id & 0xFFFFFFFFull);
+	}
+} // namespace obs
@@ -0,0 +1,130 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "util-data-binary.hpp"
+#include <cstring>
+
+template<typename T>
+static void write_pod(std::vector<char>& buf, T v)
+{
+	size_t offset = buf.size();
+	buf.resize(offset + sizeof(T));
+	std::memcpy(&buf[offset], &v, sizeof(T));
+}
+
+template<typename T>
+static bool read_pod(const char* data, size_t size, size_t& offset, T& v)
+{
+	if (size - offset < sizeof(T)) {
+		return false;
+	}
+	std::memcpy(&v, data + offset, sizeof(T));
+	offset += sizeof(T);
+	return true;
+}
+
+static bool read_bytes(const char* data, size_t size, size_t& offset, const char*& bytes, size_t& length)
+{
+	uint32_t count = 0;
+	if (!read_pod(data, size, offset, count) || (size - offset < count)) {
+		return false;
+	}
+	bytes  = data + offset;
+	length = count;
+	offset += count;
+	return true;
+}
+
+size_t util::data_binary::writer::begin_count()
+{
+	size_t offset = m_buf.size();
+	write_pod(m_buf, uint32_t(0));
+	return offset;
+}
+
+void util::data_binary::writer::end_count(size_t offset, uint32_t count)
+{
+	std::memcpy(&m_buf[offset], &count, sizeof(uint32_t));
+}
+
+void util::data_binary::writer::key(const char* key, size_t length, type t)
+{
+	value_string(key, length);
+	m_buf.push_back(char(t));
+}
+
+void util::data_binary::writer::value_bool(bool value)
+{
+	m_buf.push_back(value ? 1 : 0);
+}
+
+void util::data_binary::writer::value_int(int64_t value)
+{
+	write_pod(m_buf, value);
+}
+
+void util::data_binary::writer::value_double(double value)
+{
+	write_pod(m_buf, value);
+}
+
+void util::data_binary::writer::value_string(const char* value, size_t length)
+{
+	write_pod(m_buf, uint32_t(length));
+	m_buf.insert(m_buf.end(), value, value + length);
+}
+
+bool util::data_binary::reader::count(uint32_t& count)
+{
+	return read_pod(m_data, m_size, m_offset, count);
+}
+
+bool util::data_binary::reader::key(const char*& key, size_t& length, type& t)
+{
+	uint8_t value = 0;
+	if (!read_bytes(m_data, m_size, m_offset, key, length) || !read_pod(m_data, m_size, m_offset, value)) {
+		return false;
+	}
+	t = type(value);
+	return true;
+}
+
+bool util::data_binary::reader::value_bool(bool& value)
+{
+	uint8_t byte = 0;
+	if (!read_pod(m_data, m_size, m_offset, byte)) {
+		return false;
+	}
+	value = !!byte;
+	return true;
+}
+
+bool util::data_binary::reader::value_int(int64_t& value)
+{
+	return read_pod(m_data, m_size, m_offset, value);
+}
+
+bool util::data_binary::reader::value_double(double& value)
+{
+	return read_pod(m_data, m_size, m_offset, value);
+}
+
+bool util::data_binary::reader::value_string(const char*& value, size_t& length)
+{
+	return read_bytes(m_data, m_size, m_offset, value, length);
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace util
+{
+	// Compact binary form of an obs_data_t tree, used for settings instead of
+	//  JSON text. The server builds it straight from obs_data_t and the addon
+	//  decodes it straight into v8 objects.
+	//
+	// Layout: an object is a uint32 member count followed by the members. A
+	//  member is its key as a length prefixed string, a type byte and the
+	//  payload: nothing for null, a byte for bool, int64, double, a length
+	//  prefixed string, a nested object, or for arrays a uint32 count followed
+	//  by that many objects (obs_data arrays only hold objects).
+	namespace data_binary
+	{
+		enum class type : uint8_t
+		{
+			Null,
+			Bool,
+			Int,
+			Double,
+			String,
+			Object,
+			Array,
+		};
+
+		class writer
+		{
+			std::vector<char>& m_buf;
+
+			public:
+			writer(std::vector<char>& buf) : m_buf(buf) {}
+
+			// Objects and arrays are written before their size is known, so the count
+			//  is reserved here and filled in by end_count().
+			size_t begin_count();
+			void   end_count(size_t offset, uint32_t count);
+
+			void key(const char* key, size_t length, type t);
+			void value_bool(bool value);
+			void value_int(int64_t value);
+			void value_double(double value);
+			void value_string(const char* value, size_t length);
+		};
+
+		// Strings are handed out as pointers into the buffer, the buffer has to
+		//  outlive them.
+		class reader
+		{
+			const char* m_data;
+			size_t      m_size;
+			size_t      m_offset = 0;
+
+			public:
+			reader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+			bool count(uint32_t& count);
+			bool key(const char*& key, size_t& length, type& t);
+			bool value_bool(bool& value);
+			bool value_int(int64_t& value);
+			bool value_double(double& value);
+			bool value_string(const char*& value, size_t& length);
+		};
+	} // namespace data_binary
+} // namespace util
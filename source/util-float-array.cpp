@@ -0,0 +1,34 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "util-float-array.hpp"
+#include <cstring>
+
+std::vector<char> util::float_array::pack(const float* data, size_t count)
+{
+	std::vector<char> buf(sizeof(float) * count);
+	if (count > 0) {
+		std::memcpy(buf.data(), data, buf.size());
+	}
+	return buf;
+}
+
+std::vector<char> util::float_array::pack(const std::vector<float>& data)
+{
+	return pack(data.data(), data.size());
+}
@@ -0,0 +1,33 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace util
+{
+	// Packed array of 32-bit floats, transported as a single ipc::type::Binary
+	//  value instead of one boxed ipc::value per element. The buffer holds only
+	//  the raw floats, the element count follows from its size.
+	namespace float_array
+	{
+		std::vector<char> pack(const float* data, size_t count);
+		std::vector<char> pack(const std::vector<float>& data);
+	} // namespace float_array
+} // namespace util
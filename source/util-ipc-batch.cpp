@@ -0,0 +1,220 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "util-ipc-batch.hpp"
+#include <algorithm>
+#include <cstring>
+
+// Smallest encoding of a value (type only), a call (two empty strings and no
+//  arguments) and a result (no values). Counts come off the wire, so space is
+//  only reserved for as many records as the remaining bytes can hold.
+static const size_t min_value_size  = 1;
+static const size_t min_call_size   = 3 * sizeof(uint32_t);
+static const size_t min_result_size = sizeof(uint32_t);
+
+static size_t max_records(const std::vector<char>& buf, size_t offset, uint32_t count, size_t min_size)
+{
+	return std::min<size_t>(count, (buf.size() - offset) / min_size);
+}
+
+static void write_u32(std::vector<char>& buf, uint32_t v)
+{
+	size_t offset = buf.size();
+	buf.resize(offset + sizeof(uint32_t));
+	std::memcpy(&buf[offset], &v, sizeof(uint32_t));
+}
+
+static bool read_u32(const std::vector<char>& buf, size_t& offset, uint32_t& v)
+{
+	if (buf.size() < offset + sizeof(uint32_t)) {
+		return false;
+	}
+	std::memcpy(&v, &buf[offset], sizeof(uint32_t));
+	offset += sizeof(uint32_t);
+	return true;
+}
+
+static void write_bytes(std::vector<char>& buf, const char* data, size_t size)
+{
+	write_u32(buf, uint32_t(size));
+	buf.insert(buf.end(), data, data + size);
+}
+
+static bool read_bytes(const std::vector<char>& buf, size_t& offset, const char*& data, size_t& size)
+{
+	uint32_t length = 0;
+	if (!read_u32(buf, offset, length) || (buf.size() < offset + length)) {
+		return false;
+	}
+	data = buf.data() + offset;
+	size = length;
+	offset += length;
+	return true;
+}
+
+void util::ipc_batch::write_values(std::vector<char>& buf, const std::vector<ipc::value>& values)
+{
+	write_u32(buf, uint32_t(values.size()));
+	for (auto& value : values) {
+		buf.push_back(char(value.type));
+		switch (value.type) {
+		case ipc::type::Null:
+			break;
+		case ipc::type::String:
+			write_bytes(buf, value.value_str.data(), value.value_str.size());
+			break;
+		case ipc::type::Binary:
+			write_bytes(buf, value.value_bin.data(), value.value_bin.size());
+			break;
+		default: {
+			size_t offset = buf.size();
+			buf.resize(offset + sizeof(value.value_union));
+			std::memcpy(&buf[offset], &value.value_union, sizeof(value.value_union));
+			break;
+		}
+		}
+	}
+}
+
+bool util::ipc_batch::read_values(const std::vector<char>& buf, size_t& offset, std::vector<ipc::value>& values)
+{
+	uint32_t count = 0;
+	if (!read_u32(buf, offset, count)) {
+		return false;
+	}
+
+	values.clear();
+	values.reserve(max_records(buf, offset, count, min_value_size));
+	for (uint32_t idx = 0; idx < count; idx++) {
+		if (buf.size() < offset + 1) {
+			return false;
+		}
+
+		ipc::value value;
+		value.type = ipc::type(buf[offset]);
+		offset += 1;
+
+		const char* data = nullptr;
+		size_t      size = 0;
+		switch (value.type) {
+		case ipc::type::Null:
+			break;
+		case ipc::type::String:
+			if (!read_bytes(buf, offset, data, size)) {
+				return false;
+			}
+			value.value_str.assign(data, size);
+			break;
+		case ipc::type::Binary:
+			if (!read_bytes(buf, offset, data, size)) {
+				return false;
+			}
+			value.value_bin.assign(data, data + size);
+			break;
+		case ipc::type::Float:
+		case ipc::type::Double:
+		case ipc::type::Int32:
+		case ipc::type::Int64:
+		case ipc::type::UInt32:
+		case ipc::type::UInt64:
+			if (buf.size() < offset + sizeof(value.value_union)) {
+				return false;
+			}
+			std::memcpy(&value.value_union, &buf[offset], sizeof(value.value_union));
+			offset += sizeof(value.value_union);
+			break;
+		default:
+			return false;
+		}
+		values.push_back(std::move(value));
+	}
+	return true;
+}
+
+std::vector<char> util::ipc_batch::write_calls(const std::vector<call_t>& calls)
+{
+	std::vector<char> buf;
+	write_u32(buf, uint32_t(calls.size()));
+	for (auto& call : calls) {
+		write_bytes(buf, call.collection.data(), call.collection.size());
+		write_bytes(buf, call.function.data(), call.function.size());
+		write_values(buf, call.args);
+	}
+	return buf;
+}
+
+bool util::ipc_batch::read_calls(const std::vector<char>& buf, std::vector<call_t>& calls)
+{
+	size_t   offset = 0;
+	uint32_t count  = 0;
+	if (!read_u32(buf, offset, count)) {
+		return false;
+	}
+
+	calls.clear();
+	calls.reserve(max_records(buf, offset, count, min_call_size));
+	for (uint32_t idx = 0; idx < count; idx++) {
+		call_t      call;
+		const char* data = nullptr;
+		size_t      size = 0;
+
+		if (!read_bytes(buf, offset, data, size)) {
+			return false;
+		}
+		call.collection.assign(data, size);
+		if (!read_bytes(buf, offset, data, size)) {
+			return false;
+		}
+		call.function.assign(data, size);
+		if (!read_values(buf, offset, call.args)) {
+			return false;
+		}
+		calls.push_back(std::move(call));
+	}
+	return true;
+}
+
+std::vector<char> util::ipc_batch::write_results(const std::vector<std::vector<ipc::value>>& results)
+{
+	std::vector<char> buf;
+	write_u32(buf, uint32_t(results.size()));
+	for (auto& result : results) {
+		write_values(buf, result);
+	}
+	return buf;
+}
+
+bool util::ipc_batch::read_results(const std::vector<char>& buf, std::vector<std::vector<ipc::value>>& results)
+{
+	size_t   offset = 0;
+	uint32_t count  = 0;
+	if (!read_u32(buf, offset, count)) {
+		return false;
+	}
+
+	results.clear();
+	results.reserve(max_records(buf, offset, count, min_result_size));
+	for (uint32_t idx = 0; idx < count; idx++) {
+		std::vector<ipc::value> result;
+		if (!read_values(buf, offset, result)) {
+			return false;
+		}
+		results.push_back(std::move(result));
+	}
+	return true;
+}
@@ -0,0 +1,52 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "ipc-value.hpp"
+
+namespace util
+{
+	// Envelope for running several ipc calls in one round trip. The client
+	//  packs an ordered list of calls into a single Binary value, the server
+	//  runs them in order and packs every result list the same way.
+	//
+	// Layout: uint32 count, then per call the collection and function as
+	//  length prefixed strings followed by a value list. A value list is a
+	//  uint32 count followed by a type byte and payload per value.
+	namespace ipc_batch
+	{
+		struct call_t
+		{
+			std::string             collection;
+			std::string             function;
+			std::vector<ipc::value> args;
+		};
+
+		void write_values(std::vector<char>& buf, const std::vector<ipc::value>& values);
+		bool read_values(const std::vector<char>& buf, size_t& offset, std::vector<ipc::value>& values);
+
+		std::vector<char> write_calls(const std::vector<call_t>& calls);
+		bool              read_calls(const std::vector<char>& buf, std::vector<call_t>& calls);
+
+		std::vector<char> write_results(const std::vector<std::vector<ipc::value>>& results);
+		bool              read_results(const std::vector<char>& buf, std::vector<std::vector<ipc::value>>& results);
+	} // namespace ipc_batch
+} // namespace util
@@ -0,0 +1,113 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "util-ipc-trace.hpp"
+#include <cstring>
+
+static const char     TraceMagic[8] = {'O', 'S', 'N', 'T', 'R', 'A', 'C', 'E'};
+static const uint32_t TraceVersion  = 1;
+
+bool util::ipc_trace::writer::open(const std::string& path)
+{
+	std::unique_lock<std::mutex> ul(m_lock);
+	if (m_file.is_open())
+		m_file.close();
+
+	m_file.open(path, std::ios::binary | std::ios::trunc);
+	if (!m_file.is_open())
+		return false;
+
+	m_file.write(TraceMagic, sizeof(TraceMagic));
+	m_file.write(reinterpret_cast<const char*>(&TraceVersion), sizeof(TraceVersion));
+	return m_file.good();
+}
+
+void util::ipc_trace::writer::close()
+{
+	std::unique_lock<std::mutex> ul(m_lock);
+	if (m_file.is_open())
+		m_file.close();
+}
+
+bool util::ipc_trace::writer::is_open()
+{
+	std::unique_lock<std::mutex> ul(m_lock);
+	return m_file.is_open();
+}
+
+void util::ipc_trace::writer::write(const record_t& record)
+{
+	std::vector<char> call = util::ipc_batch::write_calls({record.call});
+	uint32_t          size = uint32_t(sizeof(record.start_ns) + sizeof(record.duration_ns) + call.size());
+
+	std::unique_lock<std::mutex> ul(m_lock);
+	if (!m_file.is_open())
+		return;
+
+	m_file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	m_file.write(reinterpret_cast<const char*>(&record.start_ns), sizeof(record.start_ns));
+	m_file.write(reinterpret_cast<const char*>(&record.duration_ns), sizeof(record.duration_ns));
+	m_file.write(call.data(), call.size());
+}
+
+bool util::ipc_trace::reader::open(const std::string& path)
+{
+	m_file.open(path, std::ios::binary);
+	if (!m_file.is_open())
+		return false;
+
+	char     magic[sizeof(TraceMagic)] = {0};
+	uint32_t version                   = 0;
+	m_file.read(magic, sizeof(magic));
+	m_file.read(reinterpret_cast<char*>(&version), sizeof(version));
+	if (!m_file.good() || (std::memcmp(magic, TraceMagic, sizeof(TraceMagic)) != 0) || (version != TraceVersion)) {
+		m_file.close();
+		return false;
+	}
+	return true;
+}
+
+void util::ipc_trace::reader::close()
+{
+	if (m_file.is_open())
+		m_file.close();
+}
+
+bool util::ipc_trace::reader::read(record_t& record)
+{
+	uint32_t size = 0;
+	if (!m_file.read(reinterpret_cast<char*>(&size), sizeof(size)))
+		return false;
+	if (size < sizeof(record.start_ns) + sizeof(record.duration_ns))
+		return false;
+
+	std::vector<char> buf(size);
+	if (!m_file.read(buf.data(), size))
+		return false;
+
+	std::memcpy(&record.start_ns, buf.data(), sizeof(record.start_ns));
+	std::memcpy(&record.duration_ns, buf.data() + sizeof(record.start_ns), sizeof(record.duration_ns));
+
+	size_t                               header = sizeof(record.start_ns) + sizeof(record.duration_ns);
+	std::vector<util::ipc_batch::call_t> calls;
+	if (!util::ipc_batch::read_calls(std::vector<char>(buf.begin() + header, buf.end()), calls) || (calls.size() != 1))
+		return false;
+
+	record.call = std::move(calls[0]);
+	return true;
+}
@@ -0,0 +1,65 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include "util-ipc-batch.hpp"
+
+namespace util
+{
+	// Compact binary trace of ipc calls, used to replay real sessions offline.
+	//
+	// Layout: the magic "OSNTRACE" and a uint32 version, then one record per
+	//  call. A record is a uint32 length followed by the start time and the
+	//  duration in nanoseconds as uint64 and the call encoded as a batch of
+	//  one (see util-ipc-batch.hpp).
+	namespace ipc_trace
+	{
+		struct record_t
+		{
+			uint64_t                start_ns;
+			uint64_t                duration_ns;
+			util::ipc_batch::call_t call;
+		};
+
+		class writer
+		{
+			std::mutex    m_lock;
+			std::ofstream m_file;
+
+			public:
+			bool open(const std::string& path);
+			void close();
+			bool is_open();
+			void write(const record_t& record);
+		};
+
+		class reader
+		{
+			std::ifstream m_file;
+
+			public:
+			bool open(const std::string& path);
+			void close();
+			bool read(record_t& record);
+		};
+	} // namespace ipc_trace
+} // namespace util
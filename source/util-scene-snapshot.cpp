@@ -0,0 +1,42 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "util-scene-snapshot.hpp"
+#include <cstring>
+
+std::vector<char> util::scene_snapshot::pack(const std::vector<item_state>& items)
+{
+	std::vector<char> buf(sizeof(item_state) * items.size());
+	if (!items.empty()) {
+		std::memcpy(buf.data(), items.data(), buf.size());
+	}
+	return buf;
+}
+
+bool util::scene_snapshot::unpack(const std::vector<char>& buf, std::vector<item_state>& items)
+{
+	if ((buf.size() % sizeof(item_state)) != 0) {
+		return false;
+	}
+
+	items.resize(buf.size() / sizeof(item_state));
+	if (!items.empty()) {
+		std::memcpy(items.data(), buf.data(), buf.size());
+	}
+	return true;
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace util
+{
+	// Transform and visibility of every item in a scene, sent by Scene.GetSnapshot
+	//  as one ipc::type::Binary value of back to back item_state records instead
+	//  of a dozen calls per item. Server and client are built together, so the
+	//  records are copied as they are.
+	namespace scene_snapshot
+	{
+		enum item_flags : uint32_t
+		{
+			flag_visible  = 1 << 0,
+			flag_selected = 1 << 1,
+		};
+
+		struct item_state
+		{
+			uint64_t item;   // osn::SceneItem id
+			uint64_t source; // osn::Source id
+			int64_t  id;     // obs_sceneitem_get_id
+			float    position[2];
+			float    rotation;
+			float    scale[2];
+			uint32_t alignment;
+			float    bounds[2];
+			uint32_t bounds_type;
+			uint32_t bounds_alignment;
+			int32_t  crop[4]; // left, top, right, bottom
+			uint32_t scale_filter;
+			uint32_t flags; // item_flags
+		};
+
+		std::vector<char> pack(const std::vector<item_state>& items);
+
+		// Copies the records into 'items', returns false if the size does not match.
+		bool unpack(const std::vector<char>& buf, std::vector<item_state>& items);
+	} // namespace scene_snapshot
+} // namespace util
@@ -0,0 +1,35 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <string>
+
+namespace util
+{
+	// Readiness handshake between the client and a server it spawned. The
+	//  client creates a named event before spawning the server, the server
+	//  sets it once its socket is listening and the client connects right
+	//  away instead of polling.
+	namespace server_ready
+	{
+		inline std::string event_name(const std::string& uri)
+		{
+			return "osn-server-ready-" + uri;
+		}
+	} // namespace server_ready
+} // namespace util
@@ -0,0 +1,207 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#include "util-shared-memory.hpp"
+#include <inttypes.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+util::shared_memory::shared_memory() {}
+
+util::shared_memory::~shared_memory()
+{
+	close();
+}
+
+#if defined(_WIN32)
+static std::wstring platform_name(const std::string& name)
+{
+	return L"Local\\" + std::wstring(name.begin(), name.end());
+}
+
+bool util::shared_memory::create(const std::string& name, size_t size)
+{
+	close();
+
+	HANDLE handle = CreateFileMappingW(
+	    INVALID_HANDLE_VALUE,
+	    NULL,
+	    PAGE_READWRITE,
+	    DWORD(uint64_t(size) >> 32),
+	    DWORD(size & 0xFFFFFFFF),
+	    platform_name(name).c_str());
+	if (!handle) {
+		return false;
+	}
+	if (GetLastError() == ERROR_ALREADY_EXISTS) {
+		CloseHandle(handle);
+		return false;
+	}
+
+	void* data = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if (!data) {
+		CloseHandle(handle);
+		return false;
+	}
+
+	m_handle = handle;
+	m_data   = data;
+	m_size   = size;
+	m_owner  = true;
+	m_name   = name;
+	return true;
+}
+
+bool util::shared_memory::open(const std::string& name, size_t size)
+{
+	close();
+
+	HANDLE handle = OpenFileMappingW(FILE_MAP_READ | FILE_MAP_WRITE, FALSE, platform_name(name).c_str());
+	if (!handle) {
+		return false;
+	}
+
+	void* data = MapViewOfFile(handle, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, size);
+	if (!data) {
+		CloseHandle(handle);
+		return false;
+	}
+
+	m_handle = handle;
+	m_data   = data;
+	m_size   = size;
+	m_owner  = false;
+	m_name   = name;
+	return true;
+}
+
+void util::shared_memory::close()
+{
+	if (m_data) {
+		UnmapViewOfFile(m_data);
+		m_data = nullptr;
+	}
+	if (m_handle) {
+		CloseHandle(m_handle);
+		m_handle = nullptr;
+	}
+	m_size  = 0;
+	m_owner = false;
+	m_name.clear();
+}
+#else
+static std::string platform_name(const std::string& name)
+{
+	return "/" + name;
+}
+
+bool util::shared_memory::create(const std::string& name, size_t size)
+{
+	close();
+
+	int fd = shm_open(platform_name(name).c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+	if (fd < 0) {
+		return false;
+	}
+	if (ftruncate(fd, off_t(size)) != 0) {
+		::close(fd);
+		shm_unlink(platform_name(name).c_str());
+		return false;
+	}
+
+	void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (data == MAP_FAILED) {
+		shm_unlink(platform_name(name).c_str());
+		return false;
+	}
+
+	m_data  = data;
+	m_size  = size;
+	m_owner = true;
+	m_name  = name;
+	return true;
+}
+
+bool util::shared_memory::open(const std::string& name, size_t size)
+{
+	close();
+
+	int fd = shm_open(platform_name(name).c_str(), O_RDWR, 0);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat st;
+	if ((fstat(fd, &st) != 0) || (size_t(st.st_size) < size)) {
+		::close(fd);
+		return false;
+	}
+
+	void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (data == MAP_FAILED) {
+		return false;
+	}
+
+	m_data  = data;
+	m_size  = size;
+	m_owner = false;
+	m_name  = name;
+	return true;
+}
+
+void util::shared_memory::close()
+{
+	if (m_data) {
+		munmap(m_data, m_size);
+		m_data = nullptr;
+	}
+	if (m_owner) {
+		shm_unlink(platform_name(m_name).c_str());
+	}
+	m_size  = 0;
+	m_owner = false;
+	m_name.clear();
+}
+#endif
+
+void* util::shared_memory::data()
+{
+	return m_data;
+}
+
+size_t util::shared_memory::size()
+{
+	return m_size;
+}
+
+const std::string& util::shared_memory::name()
+{
+	return m_name;
+}
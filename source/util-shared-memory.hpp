@@ -0,0 +1,56 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace util
+{
+	// Named shared memory region, created by the server and opened by the
+	//  client. The name is platform independent, the platform specific
+	//  prefix is added internally.
+	class shared_memory
+	{
+		void*  m_data   = nullptr;
+		size_t m_size   = 0;
+		void*  m_handle = nullptr;
+		bool   m_owner  = false;
+
+		std::string m_name;
+
+		public:
+		shared_memory();
+		~shared_memory();
+
+		shared_memory(shared_memory const&) = delete;
+		shared_memory operator=(shared_memory const&) = delete;
+
+		// Create a new region of the given size. Returns false on failure.
+		bool create(const std::string& name, size_t size);
+
+		// Open an existing region of at least the given size. Returns false on failure.
+		bool open(const std::string& name, size_t size);
+
+		void close();
+
+		void*              data();
+		size_t             size();
+		const std::string& name();
+	};
+} // namespace util
@@ -0,0 +1,184 @@
+import 'mocha';
+import { expect } from 'chai';
+import * as osn from 'obs-studio-node';
+import { IInput } from 'obs-studio-node';
+import { OBSProcessHandler } from '../util/obs_process_handler';
+
+function elapsedMs(start: [number, number]): number {
+    const diff = process.hrtime(start);
+    return (diff[0] * 1e3) + (diff[1] / 1e6);
+}
+
+describe('osn-benchmark', () => {
+    let obs: OBSProcessHandler;
+
+    // Initialize OBS process
+    before(function() {
+        obs = new OBSProcessHandler();
+        
+        if (obs.startup() !== osn.EVideoCodes.Success)
+        {
+            throw new Error("Could not start OBS process. Aborting!")
+        }
+    });
+
+    // Shutdown OBS process
+    after(function() {
+        obs.shutdown();
+        obs = null;
+    });
+
+    context('# Source enumeration', () => {
+        const sourceCount: number = 5000;
+        let inputs: IInput[] = [];
+
+        before(function() {
+            for (let i = 0; i < sourceCount; i++) {
+                inputs.push(osn.InputFactory.create('color_source', 'benchmark_input_' + i));
+            }
+        });
+
+        after(function() {
+            inputs.forEach(function(input) {
+                input.release();
+            });
+            inputs = [];
+        });
+
+        it('Enumerate 5000 public sources', () => {
+            const start = process.hrtime();
+            const sources = osn.InputFactory.getPublicSources();
+            const duration = elapsedMs(start);
+
+            // Checking if all created inputs were returned
+            expect(sources.length).to.be.at.least(sourceCount);
+            console.log('\tgetPublicSources with ' + sources.length + ' sources: ' + duration.toFixed(2) + ' ms');
+        });
+
+        it('Read the state of 200 sources', () => {
+            const subset = inputs.slice(0, 200);
+
+            let start = process.hrtime();
+            subset.forEach(function(input) {
+                const state = [input.name, input.id, input.flags, input.outputFlags, input.muted, input.enabled,
+                    input.volume, input.monitoringType, input.width, input.height, input.active, input.showing];
+            });
+            const getterDuration = elapsedMs(start);
+
+            start = process.hrtime();
+            const snapshot = osn.InputFactory.getSnapshot(subset);
+            const snapshotDuration = elapsedMs(start);
+
+            expect(snapshot.count).to.equal(subset.length);
+            console.log('\tstate of ' + subset.length + ' sources: getters ' + getterDuration.toFixed(2) + ' ms, ' +
+                'getSnapshot ' + snapshotDuration.toFixed(2) + ' ms');
+        });
+
+        it('Enumerate 5000 scene items', async () => {
+            const scene = osn.SceneFactory.create('benchmark_scene');
+            inputs.forEach(function(input) {
+                scene.add(input);
+            });
+
+            const start = process.hrtime();
+            const items = scene.getItems();
+            const duration = elapsedMs(start);
+
+            // Checking if all scene items were returned
+            expect(items.length).to.equal(sourceCount);
+            console.log('\tgetItems with ' + items.length + ' scene items: ' + duration.toFixed(2) + ' ms');
+
+            // New items signal their first transform on the next frame, waiting for it
+            await new Promise(resolve => setTimeout(resolve, 100));
+
+            let snapshotStart = process.hrtime();
+            const snapshot = scene.getSnapshot(0);
+            const snapshotDuration = elapsedMs(snapshotStart);
+
+            snapshotStart = process.hrtime();
+            const unchanged = scene.getSnapshot(snapshot.version);
+            const unchangedDuration = elapsedMs(snapshotStart);
+
+            expect(snapshot.items.length).to.equal(sourceCount);
+            expect(unchanged.changed).to.equal(false);
+            console.log('\tgetSnapshot with ' + snapshot.items.length + ' scene items: ' + snapshotDuration.toFixed(2) +
+                ' ms, unchanged ' + unchangedDuration.toFixed(2) + ' ms');
+            scene.release();
+        });
+    });
+
+    context('# Source settings transfer', () => {
+        const iterations: number = 20;
+        const sizes: [string, number][] = [['1 KB', 1024], ['100 KB', 100 * 1024], ['1 MB', 1024 * 1024]];
+
+        // Builds settings of roughly the requested JSON size out of plain
+        // values, nested objects and arrays of objects
+        function generateSettings(targetSize: number): any {
+            const settings: any = {};
+            let i = 0;
+
+            while (JSON.stringify(settings).length < targetSize) {
+                settings['text_' + i] = 'benchmark value ' + i;
+                settings['number_' + i] = i;
+                settings['ratio_' + i] = i + 0.5;
+                settings['flag_' + i] = (i % 2) == 0;
+                settings['object_' + i] = { name: 'nested_' + i, value: i, inner: { enabled: true } };
+                settings['array_' + i] = [{ index: 0, label: 'first' }, { index: 1, label: 'second' }];
+                i++;
+            }
+
+            return settings;
+        }
+
+        sizes.forEach(function(size) {
+            it('Read and update ' + size[0] + ' of settings', () => {
+                const input = osn.InputFactory.create('color_source', 'benchmark_settings_' + size[1]);
+                const settings = generateSettings(size[1]);
+                const sourceId = osn.InputFactory.getSnapshot([input]).sourceId[0];
+
+                // The JSON overloads are not used by the client anymore, they are
+                // called through a batch of one, which adds a few microseconds
+                // next to the cost of the settings themselves
+                let start = process.hrtime();
+                for (let i = 0; i < iterations; i++) {
+                    osn.IPC.callBatch([{ collection: 'Source', func: 'Update', args: [
+                        { type: 'uint64', value: sourceId },
+                        { type: 'string', value: JSON.stringify(settings) }] }]);
+                }
+                const jsonUpdateDuration = elapsedMs(start) / iterations;
+
+                start = process.hrtime();
+                for (let i = 0; i < iterations; i++) {
+                    input.update(settings);
+                }
+                const binaryUpdateDuration = elapsedMs(start) / iterations;
+
+                start = process.hrtime();
+                let jsonSettings: any;
+                for (let i = 0; i < iterations; i++) {
+                    const results = osn.IPC.callBatch([{ collection: 'Source', func: 'GetSettings', args: [
+                        { type: 'uint64', value: sourceId }] }]);
+                    jsonSettings = JSON.parse(results[0][1]);
+                }
+                const jsonReadDuration = elapsedMs(start) / iterations;
+
+                start = process.hrtime();
+                let binarySettings: any;
+                for (let i = 0; i < iterations; i++) {
+                    binarySettings = input.settings;
+                }
+                const binaryReadDuration = elapsedMs(start) / iterations;
+
+                // Both encodings have to describe the same settings
+                expect(binarySettings).to.deep.equal(jsonSettings);
+                expect(binarySettings['object_0']).to.deep.equal(settings['object_0']);
+                expect(binarySettings['array_0']).to.deep.equal(settings['array_0']);
+
+                console.log('\t' + size[0] + ' settings: update json ' + jsonUpdateDuration.toFixed(3) + ' ms, ' +
+                    'update binary ' + binaryUpdateDuration.toFixed(3) + ' ms, read json ' +
+                    jsonReadDuration.toFixed(3) + ' ms, read binary ' + binaryReadDuration.toFixed(3) + ' ms');
+                input.release();
+            });
+        });
+    });
+});
@@ -34,6 +34,36 @@ describe('osn-input', () => {
             expect(inputTypes.length).to.not.equal(0);
             expect(inputTypes).to.include.members(basicOBSInputTypes);
         });
+
+        it('Get all input types asynchronously', async () => {
+            const asyncTypes = await osn.InputFactory.typesAsync();
+
+            // Checking if the async call returns the same types
+            expect(asyncTypes).to.have.members(inputTypes);
+        });
+    });
+
+    context('# GetTypeProperties, GetTypeDefaults and GetTypeOutputFlags', () => {
+        it('Get type information without creating an input', () => {
+            // Getting type information of color source
+            const properties = osn.InputFactory.getTypeProperties('color_source');
+            const defaults = osn.InputFactory.getTypeDefaults('color_source');
+            const outputFlags = osn.InputFactory.getTypeOutputFlags('color_source');
+
+            // Checking if type information matches an instance of the type
+            const input = osn.InputFactory.create('color_source', 'input');
+            expect(properties.count()).to.equal(input.properties.count());
+            expect(properties.first().name).to.equal(input.properties.first().name);
+            expect(defaults).to.deep.equal(input.settings);
+            expect(outputFlags).to.equal(input.outputFlags);
+            input.release();
+        });
+
+        it('FAIL TEST: Try to get type information of a type that does not exist', () => {
+            expect(function() {
+                osn.InputFactory.getTypeDefaults('does_not_exist');
+            }).to.throw();
+        });
     });
 
     context('# Create', () => {
@@ -197,6 +227,53 @@ describe('osn-input', () => {
         });
     });
 
+    context('# GetSnapshot', () => {
+        it('Get the state of several inputs in one call', () => {
+            // Creating input sources
+            const first = osn.InputFactory.create('color_source', 'snapshot_first');
+            const second = osn.InputFactory.create('color_source', 'snapshot_second');
+            first.muted = true;
+            second.volume = 0.5;
+
+            // Getting snapshot of the given inputs
+            const snapshot = osn.InputFactory.getSnapshot([first, second]);
+
+            // Checking if every column matches the per input getters
+            expect(snapshot.count).to.equal(2);
+            expect(snapshot.strings[snapshot.name[0]]).to.equal('snapshot_first');
+            expect(snapshot.strings[snapshot.name[1]]).to.equal('snapshot_second');
+            expect(snapshot.id[0]).to.equal(snapshot.id[1]);
+            expect(snapshot.strings[snapshot.id[0]]).to.equal('color_source');
+            expect(snapshot.flags[0]).to.equal(first.flags);
+            expect(snapshot.outputFlags[0]).to.equal(first.outputFlags);
+            expect(snapshot.muted[0]).to.equal(1);
+            expect(snapshot.muted[1]).to.equal(0);
+            expect(snapshot.enabled[0]).to.equal(first.enabled ? 1 : 0);
+            expect(snapshot.active[1]).to.equal(second.active ? 1 : 0);
+            expect(snapshot.showing[1]).to.equal(second.showing ? 1 : 0);
+            expect(snapshot.volume[1]).to.be.closeTo(0.5, 0.0001);
+            expect(snapshot.monitoringType[0]).to.equal(first.monitoringType);
+            expect(snapshot.width[0]).to.equal(first.width);
+            expect(snapshot.height[1]).to.equal(second.height);
+
+            // Checking if a snapshot of all public inputs includes them
+            const all = osn.InputFactory.getSnapshot();
+            const names: string[] = [];
+            for (let i = 0; i < all.count; i++) {
+                names.push(all.strings[all.name[i]]);
+            }
+            expect(names).to.include.members(['snapshot_first', 'snapshot_second']);
+
+            // Checking if source ids tell the rows apart and stay the same across snapshots
+            expect(snapshot.sourceId[0]).to.not.equal(snapshot.sourceId[1]);
+            const firstRow = names.indexOf('snapshot_first');
+            expect(all.sourceId[firstRow]).to.equal(snapshot.sourceId[0]);
+
+            first.release();
+            second.release();
+        });
+    });
+
     context('# AddFilter, RemoveFilter, Filters and FindFilter', () => {
         it('Add video filter to video sources', () => {
             let videoFilters: string[] = [];
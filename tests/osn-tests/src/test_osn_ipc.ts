@@ -0,0 +1,126 @@
+import 'mocha';
+import { expect } from 'chai';
+import * as osn from 'obs-studio-node';
+import { OBSProcessHandler } from '../util/obs_process_handler';
+
+describe('osn-ipc', () => {
+    let obs: OBSProcessHandler;
+
+    // Initialize OBS process
+    before(function() {
+        obs = new OBSProcessHandler();
+        
+        if (obs.startup() !== osn.EVideoCodes.Success)
+        {
+            throw new Error("Could not start OBS process. Aborting!")
+        }
+    });
+
+    // Shutdown OBS process
+    after(function() {
+        obs.shutdown();
+        obs = null;
+    });
+
+    context('# GetStartupTiming', () => {
+        it('Report the steps of hosting the server in order', () => {
+            const timing = osn.IPC.getStartupTiming();
+
+            // Checking if every step happened after the previous one
+            expect(timing.spawnMs).to.be.greaterThan(0);
+            expect(timing.readyMs).to.be.at.least(timing.spawnMs);
+            expect(timing.connectMs).to.be.at.least(timing.readyMs);
+            expect(timing.firstCallMs).to.be.at.least(timing.connectMs);
+        });
+    });
+
+    context('# CallBatch', () => {
+        it('Run several calls in one batch', () => {
+            const results = osn.IPC.callBatch([
+                { collection: 'Video', func: 'GetSkippedFrames' },
+                { collection: 'Video', func: 'GetTotalFrames', args: [] },
+                { collection: 'Video', func: 'DoesNotExist' },
+            ]);
+
+            // Checking if every call got its own result in order. Frame counters keep
+            // running, so the later direct calls can only report as many or more.
+            expect(results.length).to.equal(3);
+            expect(results[0][0]).to.equal(0);
+            expect(results[0][1]).to.be.at.most(osn.Video.skippedFrames);
+            expect(results[1][0]).to.equal(0);
+            expect(results[1][1]).to.be.at.most(osn.Video.encodedFrames);
+
+            // Checking if an unknown function fails without failing the batch
+            expect(results[2][0]).to.not.equal(0);
+        });
+
+        it('Pass typed arguments in a batch', () => {
+            const input = osn.InputFactory.create('color_source', 'batch_input');
+            const sourceId = osn.InputFactory.getSnapshot([input]).sourceId[0];
+            const results = osn.IPC.callBatch([
+                { collection: 'Input', func: 'GetPublicSources' },
+                { collection: 'Source', func: 'IsConfigurable', args: [{ type: 'uint64', value: sourceId }] },
+            ]);
+
+            // Checking if both calls succeeded, color sources have properties to configure
+            expect(results.length).to.equal(2);
+            expect(results[0][0]).to.equal(0);
+            expect(results[1][0]).to.equal(0);
+            expect(results[1][1]).to.be.ok;
+            input.release();
+        });
+
+        it('Fail on malformed calls', () => {
+            expect(function() {
+                osn.IPC.callBatch([{ collection: 'Video' } as any]);
+            }).to.throw();
+        });
+    });
+
+    context('# GetCallStats', () => {
+        it('Report statistics for called functions', () => {
+            for (let i = 0; i < 10; i++) {
+                osn.Video.skippedFrames;
+            }
+
+            const stats = osn.IPC.getCallStats();
+            const entry = stats.find(s => s.name === 'Video.GetSkippedFrames');
+
+            // Checking if the calls were counted and timed
+            expect(entry).to.not.equal(undefined);
+            expect(entry.count).to.be.at.least(10);
+            expect(entry.totalMs).to.be.at.least(entry.maxMs);
+            expect(entry.p50Ms).to.be.at.most(entry.p99Ms);
+            expect(entry.responseBytes).to.be.greaterThan(0);
+        });
+    });
+
+    context('# SetDeferredErrorCallback', () => {
+        it('Observe one-way setters from synchronous getters', () => {
+            const input = osn.InputFactory.create('color_source', 'one_way_input');
+            input.volume = 0.5;
+            input.muted = true;
+
+            // Checking if the getters see the values set before them
+            expect(input.volume).to.equal(0.5);
+            expect(input.muted).to.equal(true);
+            input.release();
+        });
+
+        it('Report errors from one-way setters', (done) => {
+            const input = osn.InputFactory.create('color_source', 'one_way_error_input');
+            input.release();
+
+            osn.IPC.setDeferredErrorCallback((collection, func, code, message) => {
+                osn.IPC.setDeferredErrorCallback(null);
+
+                // Checking if the failed setter was reported
+                expect(collection).to.equal('Input');
+                expect(func).to.equal('SetVolume');
+                expect(code).to.not.equal(0);
+                done();
+            });
+            input.volume = 0.5;
+        });
+    });
+});
@@ -251,4 +251,60 @@ describe('osn-scene', () => {
             scene.release();
         });
     });
+
+    context('# GetSnapshot', () => {
+        it('Get the state of all scene items and only changes afterwards', async () => {
+            // Creating scene with two items
+            const scene = createScene('getSnapshot_test');
+            const firstInput = createSource('color_source', 'getSnapshot_test1');
+            const secondInput = createSource('color_source', 'getSnapshot_test2');
+            const firstSceneItem = scene.add(firstInput);
+            const secondSceneItem = scene.add(secondInput);
+            firstSceneItem.position = {x: 10, y: 20};
+            secondSceneItem.visible = false;
+
+            // Transform changes are signaled on the next frame, waiting for them
+            // so the snapshot below is a settled baseline
+            await new Promise(resolve => setTimeout(resolve, 100));
+
+            // Getting snapshot without a previous version
+            const snapshot = scene.getSnapshot(0);
+
+            // Checking if the snapshot matches the items
+            expect(snapshot.changed).to.equal(true);
+            expect(snapshot.items.length).to.equal(2);
+            expect(snapshot.items[0].source.name).to.equal('getSnapshot_test1');
+            expect(snapshot.items[0].id).to.equal(firstSceneItem.id);
+            expect(snapshot.items[0].position).to.deep.equal(firstSceneItem.position);
+            expect(snapshot.items[0].scale).to.deep.equal(firstSceneItem.scale);
+            expect(snapshot.items[0].crop).to.deep.equal(firstSceneItem.crop);
+            expect(snapshot.items[0].visible).to.equal(true);
+            expect(snapshot.items[1].source.name).to.equal('getSnapshot_test2');
+            expect(snapshot.items[1].visible).to.equal(false);
+
+            // Checking if nothing is sent when nothing changed
+            const unchanged = scene.getSnapshot(snapshot.version);
+            expect(unchanged.changed).to.equal(false);
+            expect(unchanged.version).to.equal(snapshot.version);
+            expect(unchanged.items).to.equal(undefined);
+
+            // Checking if a changed item bumps the version right away
+            secondSceneItem.rotation = 90;
+            const changed = scene.getSnapshot(snapshot.version);
+            expect(changed.changed).to.equal(true);
+            expect(changed.version).to.be.above(snapshot.version);
+            expect(changed.items[1].rotation).to.equal(90);
+
+            // Checking if the transform signal of that change doesn't count again
+            await new Promise(resolve => setTimeout(resolve, 100));
+            const settled = scene.getSnapshot(changed.version);
+            expect(settled.changed).to.equal(false);
+
+            firstSceneItem.remove();
+            secondSceneItem.remove();
+            firstInput.release();
+            secondInput.release();
+            scene.release();
+        });
+    });
 });
@@ -216,6 +216,31 @@ describe('osn-sceneitem', () => {
             expect(sceneItem.position.y).to.equal(returnedPosition.y);
             sceneItem.remove();
         });
+
+        it('Keep the last of several positions set in a row', () => {
+            let sourceType: string = 'image_source';
+            let sourceName: string = 'test_source_drag';
+
+            // Getting scene
+            const scene = osn.SceneFactory.fromName(sceneName);
+
+            // Creating input source
+            const source = createInputSource(sourceType, sourceName);
+
+            // Adding input source to scene to create scene item
+            const sceneItem = scene.add(source);
+            expect(sceneItem).to.not.equal(undefined);
+
+            // Setting position of scene item like a drag would
+            for (let i = 0; i < 100; i++) {
+                sceneItem.position = {x: i, y: i * 2};
+            }
+
+            // Checking if only the last position is visible
+            expect(sceneItem.position.x).to.equal(99);
+            expect(sceneItem.position.y).to.equal(198);
+            sceneItem.remove();
+        });
     });
 
     context('# SetRotation and GetRotation', () => {
@@ -24,6 +24,111 @@ describe('osn-source', () => {
         obs = null;
     });
 
+    context('# GetPropertiesAsync', () => {
+        it('Get properties of an input asynchronously', async () => {
+            const input = osn.InputFactory.create('color_source', 'input');
+
+            // Checking if input source was created correctly
+            expect(input).to.not.equal(undefined);
+
+            // Getting input properties both ways
+            const properties = await input.getPropertiesAsync();
+            const syncProperties = input.properties;
+
+            // Checking if the async call returns the same properties
+            expect(properties).to.not.equal(undefined);
+            expect(properties.count()).to.equal(syncProperties.count());
+
+            input.release();
+        });
+    });
+
+    context('# GetProperties (cached)', () => {
+        it('Get the same properties when reading them again unchanged', async () => {
+            const input = osn.InputFactory.create('color_source', 'input');
+
+            // Checking if input source was created correctly
+            expect(input).to.not.equal(undefined);
+
+            // The second and third reads are answered from the client cache
+            const properties = input.properties;
+            const cachedProperties = input.properties;
+            const asyncProperties = await input.getPropertiesAsync();
+
+            expect(properties).to.not.equal(undefined);
+            expect(cachedProperties.count()).to.equal(properties.count());
+            expect(asyncProperties.count()).to.equal(properties.count());
+            expect(cachedProperties.first().name).to.equal(properties.first().name);
+            expect(asyncProperties.first().name).to.equal(properties.first().name);
+
+            input.release();
+        });
+    });
+
+    context('# GetPropertiesAsync with a list page size', () => {
+        it('Get list items a page at a time', async () => {
+            const input = osn.InputFactory.create('window_capture', 'input');
+
+            // Checking if input source was created correctly
+            expect(input).to.not.equal(undefined);
+
+            const properties = await input.getPropertiesAsync(1);
+            expect(properties).to.not.equal(undefined);
+
+            let listCount = 0;
+            let property = properties.first();
+            while (property) {
+                if (property.type === osn.EPropertyType.List) {
+                    const list = property as osn.IListProperty;
+
+                    // Only the first page is sent, the rest is fetched on demand
+                    expect(list.details.items.length).to.be.at.most(1);
+                    expect(list.details.itemCount).to.be.at.least(list.details.items.length);
+                    expect(list.getItems(0, list.details.itemCount).length).to.equal(list.details.itemCount);
+                    expect(list.getItems(list.details.itemCount, 10).length).to.equal(0);
+                    listCount++;
+                }
+                property = property.next();
+            }
+
+            // window_capture has at least its window and priority lists
+            expect(listCount).to.not.equal(0);
+
+            input.release();
+        });
+    });
+
+    context('# GetSettingsSince', () => {
+        it('Get only the settings changed since a version', () => {
+            const input = osn.InputFactory.create('color_source', 'input');
+
+            // Checking if input source was created correctly
+            expect(input).to.not.equal(undefined);
+
+            // Version 0 always returns every setting
+            const initial = input.getSettingsSince(0);
+            expect(initial.full).to.equal(true);
+            expect(initial.settings).to.have.property('width');
+
+            // Updating a single key
+            input.update({ color: 4278190335 });
+            const delta = input.getSettingsSince(initial.version);
+
+            // Checking that only the changed key was returned
+            expect(delta.full).to.equal(false);
+            expect(delta.version).to.be.above(initial.version);
+            expect(Object.keys(delta.settings)).to.eql(['color']);
+            expect(delta.settings.color).to.equal(4278190335);
+
+            // Nothing changed since the last version
+            const unchanged = input.getSettingsSince(delta.version);
+            expect(unchanged.full).to.equal(false);
+            expect(Object.keys(unchanged.settings).length).to.equal(0);
+
+            input.release();
+        });
+    });
+
     context('# IsConfigurable, GetProperties, GetSettings, GetName, GetOutputFlags and GetId', () => {
         it('Get all osn-source info from all input types', () => {
             // Getting all input source types
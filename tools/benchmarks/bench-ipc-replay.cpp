@@ -0,0 +1,196 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+// Replays an IPC trace (see util-ipc-trace.hpp) against a freshly started
+//  obs-studio-server and reports the latency of every call, grouped by
+//  function. Object ids are handed out deterministically, so a trace that
+//  starts with the server replays with the same ids it was recorded with.
+//  Functions declared concurrent are not recorded, their interleaving with
+//  other calls cannot be reproduced from a single ordered trace.
+//
+// Display calls are skipped by default since window handles do not survive
+//  the recording session. Skip more with --skip Collection[.Function], e.g.
+//  to run headless on machines without a capture or audio device.
+//
+// Limitations: the server is started with whatever video and audio setup the
+//  replayed OBS_API_initAPI and settings calls ask for, there is no null
+//  video/audio mode since libobs has no null graphics module. The server entry
+//  point (obs-studio-server/source/main.cpp) is Windows-only, so on other
+//  platforms use --connect against a server started by other means.
+//
+// Usage: bench-ipc-replay <trace> (--server <binary> | --connect <uri>)
+//                         [--skip <name>]... [--realtime]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ipc-client.hpp"
+#include "util-ipc-trace.hpp"
+
+struct function_stats_t
+{
+	std::vector<uint64_t> replay_ns;
+	uint64_t              recorded_ns = 0;
+};
+
+static uint64_t percentile(std::vector<uint64_t>& values, double percentile)
+{
+	if (values.empty())
+		return 0;
+
+	size_t idx = std::min(values.size() - 1, size_t(double(values.size()) * percentile));
+	std::nth_element(values.begin(), values.begin() + idx, values.end());
+	return values[idx];
+}
+
+static std::shared_ptr<ipc::client> connect(const std::string& uri, std::chrono::seconds timeout)
+{
+	auto end = std::chrono::steady_clock::now() + timeout;
+	while (std::chrono::steady_clock::now() < end) {
+		try {
+			return std::make_shared<ipc::client>(uri);
+		} catch (...) {
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	return nullptr;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string           trace_path;
+	std::string           server_path;
+	std::string           uri;
+	std::set<std::string> skip     = {"Display"};
+	bool                  realtime = false;
+
+	for (int idx = 1; idx < argc; idx++) {
+		std::string arg = argv[idx];
+		if ((arg == "--server") && (idx + 1 < argc)) {
+			server_path = argv[++idx];
+		} else if ((arg == "--connect") && (idx + 1 < argc)) {
+			uri = argv[++idx];
+		} else if ((arg == "--skip") && (idx + 1 < argc)) {
+			skip.insert(argv[++idx]);
+		} else if (arg == "--realtime") {
+			realtime = true;
+		} else if (trace_path.empty()) {
+			trace_path = arg;
+		} else {
+			std::cerr << "Unknown argument " << arg << "." << std::endl;
+			return -1;
+		}
+	}
+
+	if (trace_path.empty() || (server_path.empty() == uri.empty())) {
+		std::cerr << "Usage: bench-ipc-replay <trace> (--server <binary> | --connect <uri>) [--skip <name>]... "
+		             "[--realtime]"
+		          << std::endl;
+		return -1;
+	}
+
+	util::ipc_trace::reader                trace;
+	std::vector<util::ipc_trace::record_t> records;
+	if (!trace.open(trace_path)) {
+		std::cerr << "Failed to open trace " << trace_path << "." << std::endl;
+		return -1;
+	}
+	for (util::ipc_trace::record_t record; trace.read(record);) {
+		if (skip.count(record.call.collection) || skip.count(record.call.collection + "." + record.call.function))
+			continue;
+		records.push_back(std::move(record));
+	}
+	trace.close();
+
+	// Start a fresh server unless told to use an existing one.
+	std::thread server;
+	if (!server_path.empty()) {
+		uri = "osn-ipc-replay-"
+		      + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+		std::string command = "\"" + server_path + "\" " + uri;
+		server              = std::thread([command]() { std::system(command.c_str()); });
+	}
+
+	auto startup = std::chrono::steady_clock::now();
+	auto conn    = connect(uri, std::chrono::seconds(30));
+	if (!conn) {
+		std::cerr << "Failed to connect to " << uri << "." << std::endl;
+		if (server.joinable())
+			server.detach();
+		return -2;
+	}
+	auto connected = std::chrono::steady_clock::now() - startup;
+	std::cout << "Connected in " << std::chrono::duration_cast<std::chrono::milliseconds>(connected).count()
+	          << " ms, replaying " << records.size() << " calls." << std::endl;
+
+	std::map<std::string, function_stats_t> stats;
+	size_t                                  failed = 0;
+	auto                                    begin  = std::chrono::steady_clock::now();
+	for (util::ipc_trace::record_t& record : records) {
+		if (realtime) {
+			std::this_thread::sleep_until(begin + std::chrono::nanoseconds(record.start_ns));
+		}
+
+		auto                    start = std::chrono::steady_clock::now();
+		std::vector<ipc::value> response =
+		    conn->call_synchronous_helper(record.call.collection, record.call.function, record.call.args);
+		uint64_t ns = uint64_t(
+		    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+		if (response.empty() || (response[0].value_union.ui64 != 0))
+			failed++;
+
+		function_stats_t& entry = stats[record.call.collection + "." + record.call.function];
+		entry.replay_ns.push_back(ns);
+		entry.recorded_ns += record.duration_ns;
+	}
+	auto total = std::chrono::steady_clock::now() - begin;
+
+	if (server.joinable()) {
+		conn->call_synchronous_helper("System", "Shutdown", {});
+		conn = nullptr;
+		server.join();
+	}
+
+	std::cout << std::left << std::setw(48) << "function" << std::right << std::setw(8) << "calls"
+	          << std::setw(14) << "recorded us" << std::setw(12) << "p50 us" << std::setw(12) << "p90 us"
+	          << std::setw(12) << "p99 us" << std::setw(12) << "max us" << std::endl;
+	for (auto& kv : stats) {
+		function_stats_t& entry = kv.second;
+		size_t            count = entry.replay_ns.size();
+		std::cout << std::left << std::setw(48) << kv.first << std::right << std::setw(8) << count
+		          << std::setw(14) << (entry.recorded_ns / count / 1000) << std::setw(12)
+		          << (percentile(entry.replay_ns, 0.50) / 1000) << std::setw(12)
+		          << (percentile(entry.replay_ns, 0.90) / 1000) << std::setw(12)
+		          << (percentile(entry.replay_ns, 0.99) / 1000) << std::setw(12)
+		          << (*std::max_element(entry.replay_ns.begin(), entry.replay_ns.end()) / 1000) << std::endl;
+	}
+	std::cout << records.size() << " calls, " << failed << " failed, "
+	          << std::chrono::duration_cast<std::chrono::milliseconds>(total).count() << " ms total." << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+// Measures object manager lookups from several threads at once, the way the
+//  IPC, audio and graphics threads hit Manager::GetInstance().find().
+//
+// Usage: bench-object-manager [objects] [threads] [lookups per thread]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "utility.hpp"
+
+struct object_t
+{
+	uint64_t value;
+};
+
+int main(int argc, char* argv[])
+{
+	size_t object_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 5000;
+	size_t thread_count = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 4;
+	size_t lookups      = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 1000000;
+
+	utility::unique_object_manager<object_t> manager;
+	std::vector<object_t>                    objects(object_count);
+	std::vector<utility::unique_id::id_t>    ids(object_count);
+	for (size_t idx = 0; idx < object_count; idx++) {
+		objects[idx].value = idx;
+		ids[idx]           = manager.allocate(&objects[idx]);
+	}
+
+	for (size_t threads = 1; threads <= thread_count; threads *= 2) {
+		std::atomic<bool>        start{false};
+		std::atomic<uint64_t>    checksum{0};
+		std::vector<std::thread> workers;
+
+		for (size_t t = 0; t < threads; t++) {
+			workers.emplace_back([&, t]() {
+				uint64_t sum = 0;
+				while (!start) {
+					std::this_thread::yield();
+				}
+				for (size_t idx = 0; idx < lookups; idx++) {
+					size_t    n   = (idx * 7919 + t) % object_count;
+					object_t* obj = manager.find(ids[n]);
+					sum += obj ? obj->value : 0;
+					sum += manager.find(&objects[n]);
+				}
+				checksum += sum;
+			});
+		}
+
+		auto tp_start = std::chrono::high_resolution_clock::now();
+		start         = true;
+		for (auto& worker : workers) {
+			worker.join();
+		}
+		auto tp_end = std::chrono::high_resolution_clock::now();
+
+		double ms = std::chrono::duration<double, std::milli>(tp_end - tp_start).count();
+		double ns = (ms * 1000000.0) / double(threads * lookups * 2);
+		std::cout << threads << " thread(s): " << ms << " ms, " << ns << " ns per lookup (checksum " << checksum
+		          << ")" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,320 @@
+/******************************************************************************
+    Copyright (C) 2016-2019 by Streamlabs (General Workings Inc)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+******************************************************************************/
+
+// Measures saving a settings category on the server, comparing the old path
+//  with the current one. The old path copies the received blob, decodes it with
+//  the previous by-value serializeCategory and hands the result down a chain of
+//  by-value save functions; the current path decodes in place and passes the
+//  category by reference. The save chain mirrors saveSettings ->
+//  saveOutputSettings -> saveAdvancedOutputSettings -> saveGenericSettings, with
+//  the config_set_* calls replaced by a checksum as those need libobs.
+//  The synthetic category is shaped like the advanced Output page.
+//
+// Usage: bench-settings-deserialize [subcategories] [parameters per subcategory] [iterations]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "nodeobs_settings_category.h"
+
+static std::vector<char> build_category(uint32_t subcategories, uint32_t params)
+{
+	std::vector<char> buffer;
+
+	for (uint32_t i = 0; i < subcategories; i++) {
+		// The frontend writes the parameter count as a uint32_t.
+		std::string name = "Subcategory " + std::to_string(i);
+		size_t      size = name.length();
+		buffer.insert(buffer.end(), reinterpret_cast<char*>(&size), reinterpret_cast<char*>(&size) + sizeof(size));
+		buffer.insert(buffer.end(), name.begin(), name.end());
+		buffer.insert(buffer.end(), reinterpret_cast<char*>(&params), reinterpret_cast<char*>(&params) + sizeof(params));
+
+		for (uint32_t j = 0; j < params; j++) {
+			Parameter param;
+			param.name        = "Parameter" + std::to_string(j);
+			param.description = "Description of parameter " + std::to_string(j);
+			param.type        = (j % 2) ? "OBS_PROPERTY_LIST" : "OBS_PROPERTY_EDIT_TEXT";
+			param.subType     = (j % 2) ? "OBS_COMBO_FORMAT_STRING" : "";
+			param.enabled     = true;
+			param.masked      = false;
+			param.visible     = true;
+
+			std::string value(64, 'v');
+			param.currentValue.assign(value.begin(), value.end());
+			param.sizeOfCurrentValue = param.currentValue.size();
+
+			std::vector<char> serialized = param.serialize();
+			buffer.insert(buffer.end(), serialized.begin(), serialized.end());
+		}
+	}
+
+	return buffer;
+}
+
+namespace old_path
+{
+	// serializeCategory as it was before decoding in place. Kept verbatim apart from formatting,
+	//  loop index types and the unused sizeStruct parameter.
+	std::vector<SubCategory> serializeCategory(uint32_t subCategoriesCount, std::vector<char> buffer)
+	{
+		std::vector<SubCategory> category;
+
+		size_t indexData = 0;
+		for (uint32_t i = 0; i < subCategoriesCount; i++) {
+			SubCategory sc;
+
+			size_t* sizeMessage = reinterpret_cast<size_t*>(buffer.data() + indexData);
+			indexData += sizeof(size_t);
+
+			std::string name(buffer.data() + indexData, *sizeMessage);
+			indexData += *sizeMessage;
+
+			uint32_t* paramsCount = reinterpret_cast<uint32_t*>(buffer.data() + indexData);
+			indexData += sizeof(uint32_t);
+
+			Parameter param;
+			for (uint32_t j = 0; j < *paramsCount; j++) {
+				size_t* sizeName = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				std::string name(buffer.data() + indexData, *sizeName);
+				indexData += *sizeName;
+
+				size_t* sizeDescription = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				std::string description(buffer.data() + indexData, *sizeDescription);
+				indexData += *sizeDescription;
+
+				size_t* sizeType = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				std::string type(buffer.data() + indexData, *sizeType);
+				indexData += *sizeType;
+
+				size_t* sizeSubType = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				std::string subType(buffer.data() + indexData, *sizeSubType);
+				indexData += *sizeSubType;
+
+				bool* enabled = reinterpret_cast<bool*>(buffer.data() + indexData);
+				indexData += sizeof(bool);
+
+				bool* masked = reinterpret_cast<bool*>(buffer.data() + indexData);
+				indexData += sizeof(bool);
+
+				bool* visible = reinterpret_cast<bool*>(buffer.data() + indexData);
+				indexData += sizeof(bool);
+
+				double* minVal = reinterpret_cast<double*>(buffer.data() + indexData);
+				indexData += sizeof(double);
+
+				double* maxVal = reinterpret_cast<double*>(buffer.data() + indexData);
+				indexData += sizeof(double);
+
+				double* stepVal = reinterpret_cast<double*>(buffer.data() + indexData);
+				indexData += sizeof(double);
+
+				size_t* sizeOfCurrentValue = reinterpret_cast<std::size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				std::vector<char> currentValue;
+				currentValue.resize(*sizeOfCurrentValue);
+				memcpy(currentValue.data(), buffer.data() + indexData, *sizeOfCurrentValue);
+				indexData += *sizeOfCurrentValue;
+
+				size_t* sizeOfValues = reinterpret_cast<size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				size_t* countValues = reinterpret_cast<size_t*>(buffer.data() + indexData);
+				indexData += sizeof(size_t);
+
+				std::vector<char> values;
+				values.resize(*sizeOfValues);
+				memcpy(values.data(), buffer.data() + indexData, *sizeOfValues);
+				indexData += *sizeOfValues;
+
+				param.name         = name;
+				param.description  = description;
+				param.type         = type;
+				param.subType      = subType;
+				param.enabled      = *enabled;
+				param.masked       = *masked;
+				param.visible      = *visible;
+				param.minVal       = *minVal;
+				param.maxVal       = *maxVal;
+				param.stepVal      = *stepVal;
+				param.currentValue = currentValue;
+				param.values       = values;
+				param.countValues  = *countValues;
+
+				sc.params.push_back(param);
+			}
+			sc.name        = name;
+			sc.paramsCount = *paramsCount;
+			category.push_back(sc);
+		}
+		return category;
+	}
+
+	void saveGenericSettings(std::vector<SubCategory> genericSettings, size_t& checksum)
+	{
+		SubCategory sc;
+
+		for (size_t i = 0; i < genericSettings.size(); i++) {
+			sc = genericSettings.at(i);
+
+			std::string nameSubcategory = sc.name;
+
+			Parameter param;
+
+			for (size_t j = 0; j < sc.params.size(); j++) {
+				param = sc.params.at(j);
+
+				std::string name  = param.name;
+				std::string type  = param.type;
+				std::string value(param.currentValue.data(), param.currentValue.size());
+				checksum += name.size() + type.size() + value.size();
+			}
+		}
+	}
+
+	void saveAdvancedOutputSettings(std::vector<SubCategory> settings, size_t& checksum)
+	{
+		// One saveGenericSettings call per subcategory, each on a copied vector like the audio tracks.
+		for (size_t i = 0; i < settings.size(); i++) {
+			std::vector<SubCategory> subSettings;
+			subSettings.push_back(settings.at(i));
+			saveGenericSettings(subSettings, checksum);
+		}
+	}
+
+	void saveOutputSettings(std::vector<SubCategory> settings, size_t& checksum)
+	{
+		Parameter   outputMode = settings.at(0).params.at(0);
+		std::string currentOutputMode(outputMode.currentValue.data(), outputMode.currentValue.size());
+		checksum += currentOutputMode.size();
+
+		saveAdvancedOutputSettings(settings, checksum);
+	}
+
+	void saveSettings(std::vector<SubCategory> settings, size_t& checksum)
+	{
+		saveOutputSettings(settings, checksum);
+	}
+} // namespace old_path
+
+namespace new_path
+{
+	void saveGenericSettings(std::vector<SubCategory>& genericSettings, size_t& checksum)
+	{
+		for (size_t i = 0; i < genericSettings.size(); i++) {
+			SubCategory& sc = genericSettings.at(i);
+
+			std::string nameSubcategory = sc.name;
+
+			for (size_t j = 0; j < sc.params.size(); j++) {
+				Parameter& param = sc.params.at(j);
+
+				std::string name  = param.name;
+				std::string type  = param.type;
+				std::string value(param.currentValue.data(), param.currentValue.size());
+				checksum += name.size() + type.size() + value.size();
+			}
+		}
+	}
+
+	void saveAdvancedOutputSettings(std::vector<SubCategory>& settings, size_t& checksum)
+	{
+		for (size_t i = 0; i < settings.size(); i++) {
+			std::vector<SubCategory> subSettings;
+			subSettings.push_back(std::move(settings.at(i)));
+			saveGenericSettings(subSettings, checksum);
+		}
+	}
+
+	void saveOutputSettings(std::vector<SubCategory>& settings, size_t& checksum)
+	{
+		Parameter&  outputMode = settings.at(0).params.at(0);
+		std::string currentOutputMode(outputMode.currentValue.data(), outputMode.currentValue.size());
+		checksum += currentOutputMode.size();
+
+		saveAdvancedOutputSettings(settings, checksum);
+	}
+
+	void saveSettings(std::vector<SubCategory>& settings, size_t& checksum)
+	{
+		saveOutputSettings(settings, checksum);
+	}
+} // namespace new_path
+
+int main(int argc, char* argv[])
+{
+	uint32_t subcategories = (argc > 1) ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 10;
+	uint32_t params        = (argc > 2) ? uint32_t(std::strtoul(argv[2], nullptr, 10)) : 20;
+	size_t   iterations    = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 20000;
+
+	if ((subcategories == 0) || (params == 0)) {
+		std::cerr << "subcategories and parameters must be at least 1" << std::endl;
+		return 1;
+	}
+
+	const std::vector<char> blob = build_category(subcategories, params);
+	std::cout << "category: " << subcategories << " x " << params << " parameters, " << blob.size() << " bytes"
+	          << std::endl;
+
+	for (int mode = 0; mode < 2; mode++) {
+		size_t checksum  = 0;
+		double decode_ms = 0;
+		double save_ms   = 0;
+
+		for (size_t idx = 0; idx < iterations; idx++) {
+			auto tp_start = std::chrono::high_resolution_clock::now();
+			std::vector<SubCategory> category;
+			if (mode == 0) {
+				// OBS_settings_saveSettings copied args[3].value_bin before decoding.
+				std::vector<char> buffer;
+				buffer.resize(blob.size());
+				memcpy(buffer.data(), blob.data(), blob.size());
+				category = old_path::serializeCategory(subcategories, buffer);
+			} else {
+				serializeCategory(subcategories, blob.data(), blob.size(), category);
+			}
+			auto tp_decoded = std::chrono::high_resolution_clock::now();
+
+			if (mode == 0) {
+				old_path::saveSettings(category, checksum);
+			} else {
+				new_path::saveSettings(category, checksum);
+			}
+			auto tp_end = std::chrono::high_resolution_clock::now();
+
+			decode_ms += std::chrono::duration<double, std::milli>(tp_decoded - tp_start).count();
+			save_ms += std::chrono::duration<double, std::milli>(tp_end - tp_decoded).count();
+		}
+
+		double us = ((decode_ms + save_ms) * 1000.0) / double(iterations);
+		std::cout << (mode == 0 ? "old: " : "new: ") << "decode " << decode_ms << " ms, save chain " << save_ms
+		          << " ms, " << us << " us per save (checksum " << checksum << ")" << std::endl;
+	}
+
+	return 0;
+}